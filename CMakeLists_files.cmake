@@ -271,6 +271,7 @@ list (APPEND MAIN_SOURCE_FILES
   opm/simulators/wells/VFPProdProperties.cpp
   opm/simulators/wells/WellAssemble.cpp
   opm/simulators/wells/WellBhpThpCalculator.cpp
+  opm/simulators/wells/WellColoring.cpp
   opm/simulators/wells/WellConstraints.cpp
   opm/simulators/wells/WellConvergence.cpp
   opm/simulators/wells/WellFilterCake.cpp
@@ -480,26 +481,32 @@ list (APPEND TEST_SOURCE_FILES
   tests/models/test_tasklets_failure.cpp
   tests/test_ALQState.cpp
   tests/test_aquifergridutils.cpp
+  tests/test_bisai.cpp
   tests/test_blackoil_amg.cpp
+  tests/test_chowpatelilu.cpp
   tests/test_convergenceoutputconfiguration.cpp
   tests/test_convergencereport.cpp
   tests/test_deferredlogger.cpp
+  tests/test_deferredreduction.cpp
   tests/test_dilu.cpp
   tests/test_group_higher_constraints.cpp
   tests/test_equil.cpp
   tests/test_extractMatrix.cpp
+  tests/test_fluxorderedsolver.cpp
   tests/test_flexiblesolver.cpp
   tests/test_GasSatfuncConsistencyChecks.cpp
   tests/test_gconsump.cpp
   tests/test_glift1.cpp
   tests/test_graphcoloring.cpp
   tests/test_GroupState.cpp
+  tests/test_hybridnewtonconfig.cpp
   tests/test_injection_topup_phase_validation.cpp
   tests/test_interregflows.cpp
   tests/test_invert.cpp
   tests/test_keyword_validator.cpp
   tests/test_LogOutputHelper.cpp
   tests/test_milu.cpp
+  tests/test_multirhsbicgstab.cpp
   tests/test_multmatrixtransposed.cpp
   tests/test_nonnc.cpp
   tests/test_norne_pvt.cpp
@@ -530,6 +537,7 @@ list (APPEND TEST_SOURCE_FILES
   tests/test_tpsa_primaryvariables.cpp
   tests/test_vfpproperties.cpp
   tests/test_WaterSatfuncConsistencyChecks.cpp
+  tests/test_wellcoloring.cpp
   tests/test_wellmodel.cpp
   tests/test_wellprodindexcalculator.cpp
   tests/test_wellstate.cpp
@@ -616,6 +624,10 @@ if(HDF5_FOUND)
   list(APPEND TEST_SOURCE_FILES tests/test_HDF5Serializer.cpp)
 endif()
 
+if(HAVE_AVX2_EXTENSION)
+  list(APPEND TEST_SOURCE_FILES tests/test_mixedbsr.cpp)
+endif()
+
 list (APPEND TEST_DATA_FILES
   tests/equil_base.DATA
   tests/equil_capillary.DATA
@@ -1054,6 +1066,8 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/linalg/blacklist.hh
   opm/simulators/linalg/combinedcriterion.hh
   opm/simulators/linalg/convergencecriterion.hh
+  opm/simulators/linalg/BISAI.hpp
+  opm/simulators/linalg/ChowPatelILU.hpp
   opm/simulators/linalg/DILU.hpp
   opm/simulators/linalg/domesticoverlapfrombcrsmatrix.hh
   opm/simulators/linalg/elementborderlistfromgrid.hh
@@ -1066,6 +1080,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/linalg/FlexibleSolver.hpp
   opm/simulators/linalg/FlexibleSolver_impl.hpp
   opm/simulators/linalg/FlowLinearSolverParameters.hpp
+  opm/simulators/linalg/FluxOrderedSolver.hpp
   opm/simulators/linalg/foreignoverlapfrombcrsmatrix.hh
   opm/simulators/linalg/getQuasiImpesWeights.hpp
   opm/simulators/linalg/globalindices.hh
@@ -1078,12 +1093,14 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/linalg/istlpreconditionerwrappers.hh
   opm/simulators/linalg/istlsolverwrappers.hh
   opm/simulators/linalg/istlsparsematrixadapter.hh
+  opm/simulators/linalg/LevelScheduling.hpp
   opm/simulators/linalg/linalgparameters.hh
   opm/simulators/linalg/linalgproperties.hh
   opm/simulators/linalg/LinearSolverAcceleratorType.hpp
   opm/simulators/linalg/linearsolverreport.hh
   opm/simulators/linalg/matrixblock.hh
   opm/simulators/linalg/MatrixMarketSpecializations.hpp
+  opm/simulators/linalg/MultiRhsBiCGSTAB.hpp
   opm/simulators/linalg/nullborderlistmanager.hh
   opm/simulators/linalg/overlappingbcrsmatrix.hh
   opm/simulators/linalg/overlappingblockvector.hh
@@ -1120,6 +1137,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/linalg/setupPropertyTree.hpp
   opm/simulators/linalg/superlubackend.hh
   opm/simulators/linalg/TPSALinearSolverParameters.hpp
+  opm/simulators/linalg/TrivialPreconditioner.hpp
   opm/simulators/linalg/twolevelmethodcpr.hh
   opm/simulators/linalg/vertexborderlistfromgrid.hh
   opm/simulators/linalg/weightedresidreductioncriterion.hh
@@ -1138,6 +1156,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/timestepping/gatherConvergenceReport.hpp
   opm/simulators/utils/ComponentName.hpp
   opm/simulators/utils/DeferredLogger.hpp
+  opm/simulators/utils/DeferredReduction.hpp
   opm/simulators/utils/DeferredLoggingErrorHelpers.hpp
   opm/simulators/utils/ParallelEclipseState.hpp
   opm/simulators/utils/ParallelFileMerger.hpp
@@ -1145,6 +1164,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/utils/ParallelRestart.hpp
   opm/simulators/utils/PressureAverage.hpp
   opm/simulators/utils/PropsDataHandle.hpp
+  opm/simulators/utils/ReusingAssign.hpp
   opm/simulators/utils/SerializationPackers.hpp
   opm/simulators/utils/VectorVectorDataHandle.hpp
   opm/simulators/utils/compressPartition.hpp
@@ -1231,6 +1251,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/wells/VFPProperties.hpp
   opm/simulators/wells/WellAssemble.hpp
   opm/simulators/wells/WellBhpThpCalculator.hpp
+  opm/simulators/wells/WellColoring.hpp
   opm/simulators/wells/WellConnectionAuxiliaryModule.hpp
   opm/simulators/wells/WellConstraints.hpp
   opm/simulators/wells/WellConvergence.hpp
@@ -1314,10 +1335,12 @@ endif()
 
 if(HDF5_FOUND)
   list(APPEND PUBLIC_HEADER_FILES
+    opm/simulators/utils/HDF5Checkpoint.hpp
     opm/simulators/utils/HDF5Serializer.hpp
     opm/simulators/utils/HDF5File.hpp
   )
   list(APPEND MAIN_SOURCE_FILES
+    opm/simulators/utils/HDF5Checkpoint.cpp
     opm/simulators/utils/HDF5Serializer.cpp
   )
 endif()
@@ -1403,6 +1426,7 @@ if(MPI_FOUND)
     opm/simulators/flow/rescoup/ReservoirCouplingMpiTraits.hpp
     opm/simulators/flow/rescoup/ReservoirCouplingMaster.hpp
     opm/simulators/flow/rescoup/ReservoirCouplingMasterReportStep.hpp
+    opm/simulators/flow/rescoup/ReservoirCouplingRequests.hpp
     opm/simulators/flow/rescoup/ReservoirCouplingSlave.hpp
     opm/simulators/flow/rescoup/ReservoirCouplingSlaveReportStep.hpp
     opm/simulators/flow/rescoup/ReservoirCouplingSpawnSlaves.hpp
@@ -39,7 +39,9 @@
 #include <opm/models/utils/signum.hh>
 
 #include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
 namespace Opm::Properties {
@@ -174,26 +176,52 @@ public:
         numPriVarsSwitched_ = comm.sum(numPriVarsSwitched_);
     }
 
+    /*!
+     * \brief Update the primary variables of a subset of the degrees of freedom.
+     *
+     * The update and residual vectors only cover the subset: entry i refers
+     * to the degree of freedom dofIndices[i]. Subsets without common degrees
+     * of freedom may be updated concurrently, so the switches are not added
+     * to numPriVarsSwitched() but returned to the caller.
+     *
+     * \return The number of degrees of freedom for which the interpretation
+     *         of the primary variables changed.
+     */
     template <class DofIndices>
-    void update_(SolutionVector& nextSolution,
-                 const SolutionVector& currentSolution,
-                 const GlobalEqVector& solutionUpdate,
-                 const GlobalEqVector& currentResidual,
-                 const DofIndices& dofIndices)
+    int update_(SolutionVector& nextSolution,
+                const SolutionVector& currentSolution,
+                const GlobalEqVector& solutionUpdate,
+                const GlobalEqVector& currentResidual,
+                const DofIndices& dofIndices)
     {
+        assert(solutionUpdate.size() == dofIndices.size());
+        int numSwitched = 0;
+        if (dofIndices.empty()) {
+            return numSwitched;
+        }
         const auto zero = 0.0 * solutionUpdate[0];
-        for (auto dofIdx : dofIndices) {
-            if (solutionUpdate[dofIdx] == zero) {
+        for (std::size_t i = 0; i < dofIndices.size(); ++i) {
+            if (solutionUpdate[i] == zero) {
                 continue;
             }
-            updatePrimaryVariables_(dofIdx,
-                                    nextSolution[dofIdx],
-                                    currentSolution[dofIdx],
-                                    solutionUpdate[dofIdx],
-                                    currentResidual[dofIdx]);
+            const auto dofIdx = dofIndices[i];
+            if (updateAndAdaptPrimaryVariables_(dofIdx,
+                                                nextSolution[dofIdx],
+                                                currentSolution[dofIdx],
+                                                solutionUpdate[i],
+                                                currentResidual[i])) {
+                ++numSwitched;
+            }
         }
+        return numSwitched;
     }
 
+    /*!
+     * \brief Add switches counted by the subset update_() to numPriVarsSwitched().
+     */
+    void addNumPriVarsSwitched(const int numSwitched)
+    { numPriVarsSwitched_ += numSwitched; }
+
 protected:
     /*!
      * \copydoc FvBaseNewtonMethod::updatePrimaryVariables_
@@ -203,6 +231,26 @@ protected:
                                  const PrimaryVariables& currentValue,
                                  const EqVector& update,
                                  const EqVector& currentResidual)
+    {
+        if (updateAndAdaptPrimaryVariables_(globalDofIdx, nextValue, currentValue,
+                                            update, currentResidual)) {
+            ++numPriVarsSwitched_;
+        }
+    }
+
+    /*!
+     * \brief Update the primary variables of a degree of freedom and adapt
+     *        their interpretation.
+     *
+     * Only touches data of the given degree of freedom.
+     *
+     * \return True if the interpretation of the primary variables changed.
+     */
+    bool updateAndAdaptPrimaryVariables_(unsigned globalDofIdx,
+                                         PrimaryVariables& nextValue,
+                                         const PrimaryVariables& currentValue,
+                                         const EqVector& update,
+                                         const EqVector& currentResidual)
     {
         static constexpr bool enableSolvent = Indices::solventSaturationIdx >= 0;
         static constexpr bool enableExtbo = Indices::zFractionIdx >= 0;
@@ -434,14 +482,13 @@ protected:
                                                                          bparams_.waterOnlyThreshold_);
         }
 
-        if (wasSwitched_[globalDofIdx]) {
-            ++numPriVarsSwitched_;
-        }
         if (bparams_.projectSaturations_) {
             nextValue.chopAndNormalizeSaturations();
         }
 
         nextValue.checkDefined();
+
+        return wasSwitched_[globalDofIdx];
     }
 
 private:
@@ -450,8 +497,9 @@ private:
     BlackoilNewtonParams<Scalar> bparams_{};
 
     // keep track of cells where the primary variable meaning has changed
-    // to detect and hinder oscillations
-    std::vector<bool> wasSwitched_{};
+    // to detect and hinder oscillations. Not std::vector<bool>, as
+    // neighbouring cells may be updated concurrently by NLDD.
+    std::vector<char> wasSwitched_{};
 };
 
 } // namespace Opm
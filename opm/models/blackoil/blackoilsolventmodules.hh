@@ -1246,7 +1246,7 @@ public:
         Valgrind::CheckDefined(solventPGrad);
 
         // correct the pressure gradients by the gravitational acceleration
-        if (Parameters::Get<Parameters::EnableGravity>()) {
+        if (elemCtx.problem().enableGravity()) {
             // estimate the gravitational acceleration at a given SCV face
             // using the arithmetic mean
             const auto& gIn = elemCtx.problem().gravity(elemCtx, i, timeIdx);
@@ -218,7 +218,7 @@ protected:
         }
 
         // correct the pressure gradients by the gravitational acceleration
-        if (Parameters::Get<Parameters::EnableGravity>()) {
+        if (elemCtx.problem().enableGravity()) {
             // estimate the gravitational acceleration at a given SCV face
             // using the arithmetic mean
             const auto& gIn = elemCtx.problem().gravity(elemCtx, i, timeIdx);
@@ -373,7 +373,7 @@ protected:
         K_ = intQuantsIn.intrinsicPermeability();
 
         // correct the pressure gradients by the gravitational acceleration
-        if (Parameters::Get<Parameters::EnableGravity>()) {
+        if (elemCtx.problem().enableGravity()) {
             // estimate the gravitational acceleration at a given SCV face
             // using the arithmetic mean
             const auto& gIn = elemCtx.problem().gravity(elemCtx, i, timeIdx);
@@ -319,6 +319,13 @@ public:
     const DimVector& gravity() const
     { return gravity_; }
 
+    /*!
+     * \brief Returns whether the <tt>EnableGravity</tt> parameter is set, i.e.,
+     *        whether the flux modules account for gravity.
+     */
+    bool enableGravity() const
+    { return enableGravity_; }
+
     /*!
      * \brief Mark grid cells for refinement or coarsening
      *
@@ -391,6 +398,7 @@ protected:
     }
 
     DimVector gravity_;
+    bool enableGravity_ = false;
 
 private:
     //! Returns the implementation of the problem (i.e. static polymorphism)
@@ -404,7 +412,8 @@ private:
     void init_()
     {
         gravity_ = 0.0;
-        if (Parameters::Get<Parameters::EnableGravity>()) {
+        enableGravity_ = Parameters::Get<Parameters::EnableGravity>();
+        if (enableGravity_) {
             gravity_[dimWorld-1]  = -9.81;
         }
     }
@@ -1444,6 +1444,10 @@ public:
      * \brief Called by the update() method if it was
      *        unsuccessful. This is primary a hook which the actual
      *        model can overload.
+     *
+     * The storage cache is left alone. Its entries for the previous time
+     * step are still valid, or are written again by the first linearization
+     * if the storage of the first iteration is recycled.
      */
     void updateFailed()
     {
@@ -1451,7 +1455,7 @@ public:
         // previous time step so that we can start the next
         // update at a physically meaningful solution.
         solution(/*timeIdx=*/0) = solution(/*timeIdx=*/1);
-        invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0);
+        asImp_().invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0);
 
 #ifndef NDEBUG
         for (unsigned timeIdx = 0; timeIdx < historySize; ++timeIdx) {
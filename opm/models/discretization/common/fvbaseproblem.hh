@@ -567,14 +567,14 @@ public:
      * \brief Returns the minimum allowable size of a time step.
      */
     Scalar minTimeStepSize() const
-    { return Parameters::Get<Parameters::MinTimeStepSize<Scalar>>(); }
+    { return problemParams_.template get<Parameters::MinTimeStepSize<Scalar>>(); }
 
     /*!
      * \brief Returns the maximum number of subsequent failures for the time integration
      *        before giving up.
      */
     unsigned maxTimeIntegrationFailures() const
-    { return Parameters::Get<Parameters::MaxTimeStepDivisions>(); }
+    { return problemParams_.template get<Parameters::MaxTimeStepDivisions>(); }
 
     /*!
      * \brief Returns if we should continue with a non-converged solution instead of
@@ -582,7 +582,7 @@ public:
      *        step size.
      */
     bool continueOnConvergenceError() const
-    { return Parameters::Get<Parameters::ContinueOnConvergenceError>(); }
+    { return problemParams_.template get<Parameters::ContinueOnConvergenceError>(); }
 
     /*!
      * \brief Impose the next time step size to be used externally.
@@ -601,7 +601,7 @@ public:
             return nextTimeStepSize_;
         }
 
-        Scalar dtNext = std::min(Parameters::Get<Parameters::MaxTimeStepSize<Scalar>>(),
+        Scalar dtNext = std::min(problemParams_.template get<Parameters::MaxTimeStepSize<Scalar>>(),
                                  newtonMethod().suggestTimeStepSize(simulator().timeStepSize()));
 
         if (dtNext < simulator().maxTimeStepSize() &&
@@ -822,7 +822,7 @@ public:
      * \brief Returns the iteration context for iteration-dependent decisions.
      */
     const NewtonIterationContext& iterationContext() const
-    { return iterationContext_; }
+    { return localIterationContext_ ? *localIterationContext_ : iterationContext_; }
 
     /*!
      * \brief Reset the iteration context for a new timestep.
@@ -834,7 +834,7 @@ public:
      * \brief Advance the iteration counter.
      */
     void advanceIteration()
-    { iterationContext_.advanceIteration(); }
+    { mutableIterationContext().advanceIteration(); }
 
     /*!
      * \brief Mark timestep initialization as complete.
@@ -851,16 +851,36 @@ private:
      * \brief Mutable access to the iteration context for LocalContextGuard.
      */
     NewtonIterationContext& mutableIterationContext()
-    { return iterationContext_; }
+    { return localIterationContext_ ? *localIterationContext_ : iterationContext_; }
+
+    /*!
+     * \brief Install a context private to the calling thread.
+     *
+     * Used by LocalContextGuard when several NLDD domains are solved
+     * concurrently, such that each thread sees its own local iteration
+     * count. Passing nullptr reverts to the shared context.
+     */
+    static void setThreadLocalIterationContext(NewtonIterationContext* context)
+    { localIterationContext_ = context; }
+
+    static inline thread_local NewtonIterationContext* localIterationContext_ = nullptr;
 
 public:
 
 protected:
+    // The parameters which are queried in every time step.
+    using ProblemParameters = Parameters::Snapshot<Parameters::MaxTimeStepSize<Scalar>,
+                                                   Parameters::MinTimeStepSize<Scalar>,
+                                                   Parameters::MaxTimeStepDivisions,
+                                                   Parameters::ContinueOnConvergenceError,
+                                                   Parameters::EnableVtkOutput>;
+
+    ProblemParameters problemParams_;
     Scalar nextTimeStepSize_;
     NewtonIterationContext iterationContext_;
 
     bool enableVtkOutput_() const
-    { return Parameters::Get<Parameters::EnableVtkOutput>(); }
+    { return problemParams_.template get<Parameters::EnableVtkOutput>(); }
 
 private:
     //! Returns the implementation of the problem (i.e. static polymorphism)
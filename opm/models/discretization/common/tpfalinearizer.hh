@@ -49,6 +49,7 @@
 #include <opm/models/discretization/common/linearizationtype.hh>
 #include <opm/simulators/linalg/exportSystem.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <exception>   // current_exception, rethrow_exception
@@ -58,6 +59,7 @@
 #include <numeric>
 #include <set>
 #include <stdexcept>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -475,6 +477,8 @@ public:
     void updateDiscretizationParameters()
     {
         updateStoredTransmissibilities();
+        // The cached flux contributions used the old transmissibilities.
+        assembledVersions_.clear();
     }
 
     void updateBoundaryConditionData()
@@ -895,6 +899,113 @@ public:
     }
 
 private:
+    // Whether the velocities of the faces of a cell are stored for output.
+    template <class BlockVelocity>
+    bool storeVelocity_(const unsigned globI,
+                        const bool dispersionActive,
+                        const BlockVelocity& blockVelocity) const
+    {
+        if (dispersionActive || enableBioeffects) {
+            return true;
+        }
+        return !blockVelocity.empty() &&
+            std::ranges::binary_search(blockVelocity, simulator_().vanguard().cartesianIndex(globI));
+    }
+
+    // Add the flux from globI to its neighbor with index loc, with the derivatives
+    // with respect to the primary variables of globI, to the residual of globI and
+    // to the diagonal block and the neighbor's block in the column of globI.
+    // If iqVersions is not null, the contribution is cached and reused.
+    void assembleFlux_(const unsigned globI,
+                       const NeighborInfoCPU& nbInfo,
+                       const unsigned loc,
+                       const IntensiveQuantities& intQuantsIn,
+                       const bool storeVelocity,
+                       const std::vector<unsigned>* iqVersions)
+    {
+        OPM_TIMEBLOCK_LOCAL(fluxCalculationForEachFace, Subsystem::Assembly);
+        const unsigned globJ = nbInfo.neighbor;
+        assert(globJ != globI);
+        VectorBlock res(0.0);
+        MatrixBlock bMat(0.0);
+        const std::size_t entry = iqVersions ? nbOffset_[globI] + loc : 0;
+        if (contributionUnchanged_(iqVersions, globI) && contributionUnchanged_(iqVersions, globJ)) {
+            // The velocities stored for output are also unchanged.
+            res = fluxResCache_[entry];
+            bMat = fluxJacCache_[entry];
+        }
+        else {
+            ADVectorBlock adres(0.0);
+            ADVectorBlock darcyFlux(0.0);
+            const IntensiveQuantities& intQuantsEx = model_().intensiveQuantities(globJ, /*timeIdx*/ 0);
+            LocalResidual::computeFlux(adres, darcyFlux, globI, globJ, intQuantsIn, intQuantsEx,
+                                       nbInfo.res_nbinfo, problem_().moduleParams());
+            adres *= nbInfo.res_nbinfo.faceArea;
+            if (storeVelocity) {
+                for (unsigned phaseIdx = 0; phaseIdx < numEq; ++phaseIdx) {
+                    velocityInfo_[globI][loc].velocity[phaseIdx] =
+                        darcyFlux[phaseIdx].value() / nbInfo.res_nbinfo.faceArea;
+                }
+            }
+            setResAndJacobi(res, bMat, adres);
+            if (iqVersions) {
+                fluxResCache_[entry] = res;
+                fluxJacCache_[entry] = bMat;
+            }
+        }
+        residual_[globI] += res;
+        //SparseAdapter syntax:  jacobian_->addToBlock(globI, globI, bMat);
+        *diagMatAddress_[globI] += bMat;
+        bMat *= -1.0;
+        //SparseAdapter syntax: jacobian_->addToBlock(globJ, globI, bMat);
+        *nbInfo.matBlockAddress += bMat;
+    }
+
+    // Set up the caches of the flux and storage contributions, if the model
+    // tracks which cells had their intensive quantities updated. Returns the
+    // versions to pass to the assembly, or null if the caches are not used.
+    const std::vector<unsigned>* prepareContributionCache_(const std::vector<unsigned>& versions)
+    {
+        const unsigned numCells = neighborInfo_.size();
+        if (versions.size() != numCells) {
+            return nullptr;
+        }
+        if (nbOffset_.size() != numCells + 1) {
+            nbOffset_.resize(numCells + 1);
+            nbOffset_[0] = 0;
+            for (unsigned globI = 0; globI < numCells; ++globI) {
+                nbOffset_[globI + 1] = nbOffset_[globI] + neighborInfo_[globI].size();
+            }
+            fluxResCache_.resize(nbOffset_.back());
+            fluxJacCache_.resize(nbOffset_.back());
+            storageResCache_.resize(numCells);
+            storageJacCache_.resize(numCells);
+            assembledVersions_.clear();
+        }
+        return &versions;
+    }
+
+    // Whether the cached contributions of a cell were computed with its current
+    // intensive quantities.
+    bool contributionUnchanged_(const std::vector<unsigned>* iqVersions,
+                                const unsigned globI) const
+    {
+        return iqVersions && !assembledVersions_.empty() &&
+            (*iqVersions)[globI] == assembledVersions_[globI];
+    }
+
+    // Whether a cell belongs to the domain being linearized.
+    template <class SubDomainType>
+    static bool inDomain_(const SubDomainType& domain, const unsigned globI)
+    {
+        if constexpr (requires { domain.interior; }) {
+            return domain.interior.empty() || domain.interior[globI];
+        }
+        else {
+            return true;
+        }
+    }
+
     template <class SubDomainType>
     void linearize_(const SubDomainType& domain)
     {
@@ -919,6 +1030,16 @@ private:
         // Fetch timestepsize used later in accumulation term.
         const double dt = simulator_().timeStepSize();
 
+        // Reuse of the contributions of cells whose intensive quantities did not
+        // change is only done for the full domain. Subdomains may be linearized
+        // concurrently, so no state is kept in members.
+        const std::vector<unsigned>* iqVersions = nullptr;
+        if constexpr (std::is_same_v<SubDomainType, FullDomain<>>) {
+            if constexpr (requires { model_().intensiveQuantitiesVersions(); }) {
+                iqVersions = prepareContributionCache_(model_().intensiveQuantitiesVersions());
+            }
+        }
+
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
@@ -929,47 +1050,15 @@ private:
             VectorBlock res(0.0);
             MatrixBlock bMat(0.0);
             ADVectorBlock adres(0.0);
-            ADVectorBlock darcyFlux(0.0);
             const IntensiveQuantities& intQuantsIn = model_().intensiveQuantities(globI, /*timeIdx*/ 0);
 
             // Flux term.
             {
                 OPM_TIMEBLOCK_LOCAL(fluxCalculationForEachCell, Subsystem::Assembly);
-                short loc = 0;
+                const bool storeVelocity = storeVelocity_(globI, dispersionActive, blockVelocity);
+                unsigned loc = 0;
                 for (const auto& nbInfo : nbInfos) {
-                    OPM_TIMEBLOCK_LOCAL(fluxCalculationForEachFace, Subsystem::Assembly);
-                    const unsigned globJ = nbInfo.neighbor;
-                    assert(globJ != globI);
-                    res = 0.0;
-                    bMat = 0.0;
-                    adres = 0.0;
-                    darcyFlux = 0.0;
-                    const IntensiveQuantities& intQuantsEx = model_().intensiveQuantities(globJ, /*timeIdx*/ 0);
-                    LocalResidual::computeFlux(adres, darcyFlux, globI, globJ, intQuantsIn, intQuantsEx,
-                                               nbInfo.res_nbinfo, problem_().moduleParams());
-                    adres *= nbInfo.res_nbinfo.faceArea;
-                    if (dispersionActive || enableBioeffects) {
-                        for (unsigned phaseIdx = 0; phaseIdx < numEq; ++phaseIdx) {
-                            velocityInfo_[globI][loc].velocity[phaseIdx] =
-                                darcyFlux[phaseIdx].value() / nbInfo.res_nbinfo.faceArea;
-                        }
-                    }
-                    else if (!blockVelocity.empty()) {
-                        if (std::ranges::binary_search(blockVelocity,
-                                                       simulator_().vanguard().cartesianIndex(globI))) {
-                            for (unsigned phaseIdx = 0; phaseIdx < numEq; ++phaseIdx) {
-                                velocityInfo_[globI][loc].velocity[phaseIdx] =
-                                    darcyFlux[phaseIdx].value() / nbInfo.res_nbinfo.faceArea;
-                            }
-                        }
-                    }
-                    setResAndJacobi(res, bMat, adres);
-                    residual_[globI] += res;
-                    //SparseAdapter syntax:  jacobian_->addToBlock(globI, globI, bMat);
-                    *diagMatAddress_[globI] += bMat;
-                    bMat *= -1.0;
-                    //SparseAdapter syntax: jacobian_->addToBlock(globJ, globI, bMat);
-                    *nbInfo.matBlockAddress += bMat;
+                    assembleFlux_(globI, nbInfo, loc, intQuantsIn, storeVelocity, iqVersions);
                     ++loc;
                 }
             }
@@ -977,12 +1066,20 @@ private:
             // Accumulation term.
             const double volume = model_().dofTotalVolume(globI);
             const Scalar storefac = volume / dt;
-            adres = 0.0;
-            {
+            if (contributionUnchanged_(iqVersions, globI)) {
+                res = storageResCache_[globI];
+                bMat = storageJacCache_[globI];
+            }
+            else {
                 OPM_TIMEBLOCK_LOCAL(computeStorage, Subsystem::Assembly);
+                adres = 0.0;
                 LocalResidual::template computeStorage<Evaluation>(adres, intQuantsIn);
+                setResAndJacobi(res, bMat, adres);
+                if (iqVersions) {
+                    storageResCache_[globI] = res;
+                    storageJacCache_[globI] = bMat;
+                }
             }
-            setResAndJacobi(res, bMat, adres);
             // Either use cached storage term, or compute it on the fly.
             if (model_().enableStorageCache()) {
                 // The cached storage for timeIdx 0 (current time) is not
@@ -1043,14 +1140,24 @@ private:
             *diagMatAddress_[globI] += bMat;
         } // end of loop for cell globI.
 
-        // Add sparse source terms. For now only wells.
+        if (iqVersions) {
+            assembledVersions_ = *iqVersions;
+        }
+
+        // Add sparse source terms. For now only wells. Only the cells of the
+        // domain are written, as other domains may be linearized concurrently.
         if (separateSparseSourceTerms_) {
-            problem_().wellModel().addReservoirSourceTerms(residual_, diagMatAddress_);
+            if constexpr (requires { domain.interior; }) {
+                problem_().wellModel().addReservoirSourceTerms(residual_, diagMatAddress_, domain.interior);
+            }
+            else {
+                problem_().wellModel().addReservoirSourceTerms(residual_, diagMatAddress_);
+            }
         }
 
         // Boundary terms. Only looping over cells with nontrivial bcs.
         for (const auto& bdyInfo : boundaryInfo_) {
-            if (bdyInfo.bcdata.type == BCType::NONE) {
+            if (bdyInfo.bcdata.type == BCType::NONE || !inDomain_(domain, bdyInfo.cell)) {
                 continue;
             }
 
@@ -1143,6 +1250,15 @@ private:
     };
     std::vector<BoundaryInfo> boundaryInfo_;
 
+    // Flux and storage contributions of the last full-domain linearization, and
+    // the versions of the intensive quantities they were computed from.
+    std::vector<unsigned> assembledVersions_;
+    std::vector<std::size_t> nbOffset_;
+    std::vector<VectorBlock> fluxResCache_;
+    std::vector<MatrixBlock> fluxJacCache_;
+    std::vector<VectorBlock> storageResCache_;
+    std::vector<MatrixBlock> storageJacCache_;
+
     bool separateSparseSourceTerms_ = false;
 
     FullDomain<> fullDomain_;
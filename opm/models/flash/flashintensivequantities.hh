@@ -108,7 +108,7 @@ public:
 
         const auto& priVars = elemCtx.primaryVars(dofIdx, timeIdx);
         const auto& problem = elemCtx.problem();
-        const Scalar flashTolerance = Parameters::Get<Parameters::FlashTolerance<Scalar>>();
+        const Scalar flashTolerance = elemCtx.model().flashTolerance();
 
         // extract the total molar densities of the components
         ComponentVector cTotal;
@@ -217,6 +217,7 @@ class FlashModel
 public:
     explicit FlashModel(Simulator& simulator)
         : ParentType(simulator)
+        , flashTolerance_(Parameters::Get<Parameters::FlashTolerance<Scalar>>())
     {}
 
     /*!
@@ -339,6 +340,12 @@ public:
         return FluidSystem::molarMass(compIdx);
     }
 
+    /*!
+     * \brief The maximum tolerance of the flash solver.
+     */
+    Scalar flashTolerance() const
+    { return flashTolerance_; }
+
     void registerOutputModules_()
     {
         ParentType::registerOutputModules_();
@@ -352,6 +359,9 @@ public:
             this->addOutputModule(std::make_unique<VtkEnergyModule<TypeTag>>(this->simulator_));
         }
     }
+
+private:
+    Scalar flashTolerance_;
 };
 
 } // namespace Opm
@@ -121,10 +121,10 @@ protected:
 
         // make sure that the error never grows beyond the maximum
         // allowed one
-        if (this->error_ > Parameters::Get<Parameters::NewtonMaxError<Scalar>>()) {
+        if (this->error_ > this->params_.maxError_) {
             throw Opm::NumericalProblem("Newton: Error " + std::to_string(double(this->error_)) +
                                         " is larger than maximum allowed error of " +
-                                         std::to_string(Parameters::Get<Parameters::NewtonMaxError<Scalar>>()));
+                                         std::to_string(this->params_.maxError_));
         }
     }
 
@@ -117,9 +117,10 @@ public:
         const auto& priVars = elemCtx.primaryVars(dofIdx, timeIdx);
         const auto& problem = elemCtx.problem();
 
-        const Scalar flashTolerance = Parameters::Get<Parameters::FlashTolerance<Scalar>>();
-        const int flashVerbosity = Parameters::Get<Parameters::FlashVerbosity>();
-        const std::string flashTwoPhaseMethod = Parameters::Get<Parameters::FlashTwoPhaseMethod>();
+        const auto& model = elemCtx.model();
+        const Scalar flashTolerance = model.flashTolerance();
+        const int flashVerbosity = model.flashVerbosity();
+        const std::string& flashTwoPhaseMethod = model.flashTwoPhaseMethodName();
         // TODO: the formulation here is still to begin with XMF and YMF values to derive ZMF value
         // TODO: we should check how we update ZMF in the newton update, since it is the primary variables.
 
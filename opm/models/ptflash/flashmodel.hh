@@ -207,9 +207,14 @@ class FlashModel
 
     using EnergyModule = ::Opm::EnergyModule<TypeTag, enableEnergy>;
 
+    using FlashParameters = Parameters::Snapshot<Parameters::FlashTolerance<Scalar>,
+                                                 Parameters::FlashVerbosity>;
+
 public:
     explicit FlashModel(Simulator& simulator)
         : ParentType(simulator)
+        , flashTwoPhaseMethod_(flashTwoPhaseMethodFromString(Parameters::Get<Parameters::FlashTwoPhaseMethod>()))
+        , flashTwoPhaseMethodName_(flashTwoPhaseMethodName(flashTwoPhaseMethod_))
     {}
 
     /*!
@@ -297,6 +302,31 @@ public:
         return oss.str();
     }
 
+    /*!
+     * \brief The maximum tolerance of the flash solver.
+     */
+    Scalar flashTolerance() const
+    { return flashParams_.template get<Parameters::FlashTolerance<Scalar>>(); }
+
+    /*!
+     * \brief The verbosity level of the flash solver.
+     */
+    int flashVerbosity() const
+    { return flashParams_.template get<Parameters::FlashVerbosity>(); }
+
+    /*!
+     * \brief The method for solving the vapor-liquid composition.
+     */
+    FlashTwoPhaseMethodType flashTwoPhaseMethod() const
+    { return flashTwoPhaseMethod_; }
+
+    /*!
+     * \brief The name of the method for solving the vapor-liquid composition,
+     *        as expected by the flash solver.
+     */
+    const std::string& flashTwoPhaseMethodName() const
+    { return flashTwoPhaseMethodName_; }
+
     void registerOutputModules_()
     {
         ParentType::registerOutputModules_();
@@ -311,6 +341,11 @@ public:
             this->addOutputModule(std::make_unique<VtkEnergyModule<TypeTag>>(this->simulator_));
         }
     }
+
+private:
+    FlashParameters flashParams_;
+    FlashTwoPhaseMethodType flashTwoPhaseMethod_;
+    std::string flashTwoPhaseMethodName_;
 };
 
 } // namespace Opm
@@ -32,6 +32,37 @@
 
 #include <opm/models/flash/flashparameters.hh>
 
+#include <array>
+#include <stdexcept>
+#include <string>
+
+namespace Opm {
+
+//! \brief The methods for solving the vapor-liquid composition of the two-phase flash
+enum class FlashTwoPhaseMethodType { Ssi, Newton, SsiNewton };
+
+inline const std::string& flashTwoPhaseMethodName(FlashTwoPhaseMethodType method)
+{
+    static const std::array<std::string, 3> names = {"ssi", "newton", "ssi+newton"};
+    return names[static_cast<int>(method)];
+}
+
+inline FlashTwoPhaseMethodType flashTwoPhaseMethodFromString(const std::string& name)
+{
+    for (const auto method : {FlashTwoPhaseMethodType::Ssi,
+                              FlashTwoPhaseMethodType::Newton,
+                              FlashTwoPhaseMethodType::SsiNewton})
+    {
+        if (name == flashTwoPhaseMethodName(method)) {
+            return method;
+        }
+    }
+    throw std::invalid_argument("Unknown two-phase flash method '" + name +
+                                "'. Available options are: ssi, newton, ssi+newton");
+}
+
+} // namespace Opm
+
 namespace Opm::Parameters {
 
 //! Two-phase flash method
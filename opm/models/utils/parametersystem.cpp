@@ -42,9 +42,12 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <charconv>
 #include <fstream>
+#include <iostream>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <sys/ioctl.h>
 #include <unistd.h>
@@ -117,6 +120,25 @@ private:
     }
 };
 
+// Number of currently open time step loop scopes.
+std::atomic<int> timestepLoopDepth{0};
+
+// Number of parameters retrieved inside a time step loop scope.
+std::atomic<std::size_t> timestepLoopGets{0};
+
+#ifndef NDEBUG
+void reportGetInTimestepLoop(const std::string& paramName)
+{
+    static std::mutex mutex;
+    static std::set<std::string> reported;
+    std::lock_guard lock(mutex);
+    if (reported.insert(paramName).second) {
+        std::cerr << "Warning: Parameter " << paramName << " is retrieved inside a time step loop. "
+                  << "Its value should be read once up front." << std::endl;
+    }
+}
+#endif
+
 
 void getFlattenedKeyList(std::vector<std::string>& dest,
                          const Dune::ParameterTree& tree,
@@ -364,6 +386,13 @@ template<class ParamType>
 ParamType Get_(const std::string& paramName, ParamType defaultValue,
                bool errorIfNotRegistered)
 {
+    if (timestepLoopDepth > 0) {
+        ++timestepLoopGets;
+#ifndef NDEBUG
+        reportGetInTimestepLoop(paramName);
+#endif
+    }
+
     if (errorIfNotRegistered) {
         if (MetaData::registrationOpen()) {
             throw std::runtime_error("Parameters can only be retrieved after _all_ of them have "
@@ -483,9 +512,25 @@ void SetDefault_(const std::string& paramName,
 
 } // namespace detail
 
+TimestepLoopScope::TimestepLoopScope()
+{
+    ++timestepLoopDepth;
+}
+
+TimestepLoopScope::~TimestepLoopScope()
+{
+    --timestepLoopDepth;
+}
+
+std::size_t TimestepLoopScope::numGets()
+{
+    return timestepLoopGets;
+}
+
 void reset()
 {
     MetaData::clear();
+    timestepLoopGets = 0;
 }
 
 bool IsRegistrationOpen()
@@ -34,11 +34,14 @@
 
 #include <dune/common/classname.hh>
 
+#include <array>
+#include <cstddef>
 #include <cstring>
 #include <functional>
 #include <set>
 #include <sstream>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <vector>
 
@@ -70,6 +73,12 @@ auto getParamName()
     }
 }
 
+//! \brief The type in which the value of a parameter is returned.
+template<class Param>
+using ParamValueType = std::conditional_t<std::is_same_v<decltype(Param::value),
+                                                         const char* const>, std::string,
+                                          std::remove_const_t<decltype(Param::value)>>;
+
 //! \brief Private implementation.
 template<class ParamType>
 ParamType Get_(const std::string& paramName, ParamType defaultValue,
@@ -186,14 +195,84 @@ bool printUnused(std::ostream& os);
 template <class Param>
 auto Get(bool errorIfNotRegistered = true)
 {
-    using ParamType = std::conditional_t<std::is_same_v<decltype(Param::value),
-                                                        const char* const>, std::string,
-                                         std::remove_const_t<decltype(Param::value)>>;
-    ParamType defaultValue = Param::value;
+    detail::ParamValueType<Param> defaultValue = Param::value;
     return detail::Get_(detail::getParamName<Param>(),
                         defaultValue, errorIfNotRegistered);
 }
 
+/*!
+ * \ingroup Parameter
+ *
+ * \brief Immutable copy of the values of a set of runtime parameters.
+ *
+ * Retrieving a parameter with Get() looks it up by name, which is too
+ * expensive for code executed per cell or per face. Such code should use the
+ * values of a snapshot instead, which is created once, after all parameters
+ * have been registered, and may be held by value.
+ *
+ * Example:
+ *
+ * \code
+ * using FluxParams = Snapshot<EnableGravity, UpwindWeight>;
+ * const FluxParams params;
+ * if (params.get<EnableGravity>()) { ... }
+ * \endcode
+ */
+template <class... Params>
+class Snapshot
+{
+public:
+    Snapshot()
+        : values_(Get<Params>()...)
+    {}
+
+    template <class Param>
+    const detail::ParamValueType<Param>& get() const
+    {
+        static_assert((std::is_same_v<Param, Params> || ...),
+                      "The parameter is not part of the snapshot");
+        return std::get<index_<Param>()>(values_);
+    }
+
+private:
+    template <class Param>
+    static constexpr std::size_t index_()
+    {
+        constexpr std::array<bool, sizeof...(Params)> matches = {std::is_same_v<Param, Params>...};
+        std::size_t idx = 0;
+        while (!matches[idx]) {
+            ++idx;
+        }
+        return idx;
+    }
+
+    std::tuple<detail::ParamValueType<Params>...> values_;
+};
+
+/*!
+ * \ingroup Parameter
+ *
+ * \brief Marks a scope in which runtime parameters should not be retrieved.
+ *
+ * The simulators open such a scope for each time step. In builds without
+ * NDEBUG, every parameter which is retrieved with Get() while a scope is open
+ * is reported once on the standard error stream. Its value should be read up
+ * front instead, e.g. into a Snapshot.
+ */
+class TimestepLoopScope
+{
+public:
+    TimestepLoopScope();
+    ~TimestepLoopScope();
+
+    TimestepLoopScope(const TimestepLoopScope&) = delete;
+    TimestepLoopScope& operator=(const TimestepLoopScope&) = delete;
+
+    //! \brief Number of parameters retrieved with Get() inside any scope
+    //!        since the last reset() of the parameter system.
+    static std::size_t numGets();
+};
+
 /*!
  * \ingroup Parameter
  *
@@ -292,14 +371,10 @@ template <class Param>
 void Register(const char* usageString)
 {
     const std::string paramName = detail::getParamName<Param>();
-    const auto defaultValue = Param::value;
-    using ParamType = std::conditional_t<std::is_same_v<decltype(defaultValue),
-                                                        const char* const>, std::string,
-                                         std::remove_const_t<decltype(defaultValue)>>;
-
     std::ostringstream oss;
-    oss << defaultValue;
-    detail::Register_(paramName, Dune::className<ParamType>(), oss.str(), usageString);
+    oss << Param::value;
+    detail::Register_(paramName, Dune::className<detail::ParamValueType<Param>>(),
+                      oss.str(), usageString);
 }
 
 /*!
@@ -661,6 +661,7 @@ public:
         bool episodeBegins = episodeIsOver() || (timeStepIdx_ == 0);
         // do the time steps
         while (!finished()) {
+            const Parameters::TimestepLoopScope timestepLoopScope;
             prePostProcessTimer_.start();
             if (episodeBegins) {
                 // notify the problem that a new episode has just been
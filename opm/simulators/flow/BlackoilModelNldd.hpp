@@ -24,8 +24,11 @@
 #ifndef OPM_BLACKOILMODEL_NLDD_HEADER_INCLUDED
 #define OPM_BLACKOILMODEL_NLDD_HEADER_INCLUDED
 
+#include <dune/common/fmatrix.hh>
 #include <dune/common/timer.hh>
+#include <dune/istl/bcrsmatrix.hh>
 #include <dune/istl/istlexception.hh>
+#include <dune/istl/paamg/graph.hh>
 
 #include <opm/common/Exceptions.hpp>
 
@@ -41,6 +44,7 @@
 #include <opm/simulators/flow/SubDomain.hpp>
 
 #include <opm/simulators/linalg/extractMatrix.hpp>
+#include <opm/simulators/linalg/GraphColoring.hpp>
 
 #if COMPILE_GPU_BRIDGE
 #include <opm/simulators/linalg/ISTLSolverGpuBridge.hpp>
@@ -65,8 +69,10 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <exception>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <set>
 #include <sstream>
@@ -75,6 +81,10 @@
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace Opm {
 
 template<class TypeTag> class BlackoilModel;
@@ -191,10 +201,20 @@ public:
 
         // Initialize domain_needs_solving_ to true for all domains
         domain_needs_solving_.resize(num_domains, true);
+        domain_num_switched_.resize(num_domains, 0);
 
         // Set up container for the local system matrices.
         domain_matrices_.resize(num_domains);
 
+        // Set up the domain-sized residual and update vectors, reused
+        // across all local Newton iterations.
+        domain_res_.resize(num_domains);
+        domain_x_.resize(num_domains);
+        for (int index = 0; index < num_domains; ++index) {
+            domain_res_[index].resize(domains_[index].cells.size());
+            domain_x_[index].resize(domains_[index].cells.size());
+        }
+
         // Set up container for the local linear solvers.
         for (int index = 0; index < num_domains; ++index) {
             // TODO: The ISTLSolver constructor will make
@@ -280,47 +300,24 @@ public:
         // -----------   Solve each domain separately   -----------
         DeferredLogger logger;
         std::vector<SimulatorReportSingle> domain_reports(domains_.size());
+        std::ranges::fill(domain_num_switched_, 0);
 
         OPM_BEGIN_PARALLEL_TRY_CATCH()
-        for (const int domain_index : domain_order) {
-            const auto& domain = domains_[domain_index];
-            SimulatorReportSingle local_report;
-            detailTimer.reset();
-            detailTimer.start();
-
-            domain_needs_solving_[domain_index] = checkIfSubdomainNeedsSolving(domain);
-
-            updateMobilities(domain);
-
-            if (domain.skip || !domain_needs_solving_[domain_index]) {
-                local_report.skipped_domains = true;
-                local_report.converged = true;
-                domain_reports[domain.index] = local_report;
-                continue;
-            }
-            switch (model_.param().local_solve_approach_) {
-            case DomainSolveApproach::Jacobi:
-                solveDomainJacobi(solution, locally_solved, local_report, logger,
-                                  timer, domain);
-                break;
-            default:
-            case DomainSolveApproach::GaussSeidel:
-                solveDomainGaussSeidel(solution, locally_solved, local_report, logger,
-                                       timer, domain);
-                break;
-            }
-            // This should have updated the global matrix to be
-            // dR_i/du_j evaluated at new local solutions for
-            // i == j, at old solution for i != j.
-            if (!local_report.converged) {
-                // TODO: more proper treatment, including in parallel.
-                logger.debug(fmt::format("Convergence failure in domain {} on rank {}." , domain.index, rank_));
+        if (this->useThreadedDomainSolves()) {
+            this->solveDomainsThreaded(domain_order, solution, locally_solved,
+                                       domain_reports, logger, timer);
+        } else {
+            for (const int domain_index : domain_order) {
+                domain_reports[domain_index] =
+                    this->solveSingleDomain(domains_[domain_index], solution,
+                                            locally_solved, logger, timer);
             }
-            local_report.solver_time += detailTimer.stop();
-            domain_reports[domain.index] = local_report;
         }
         OPM_END_PARALLEL_TRY_CATCH("Unexpected exception in local domain solve: ", model_.simulator().vanguard().grid().comm());
 
+        model_.simulator().model().newtonMethod().addNumPriVarsSwitched(
+            std::accumulate(domain_num_switched_.begin(), domain_num_switched_.end(), 0));
+
         detailTimer.reset();
         detailTimer.start();
         // Communicate and log all messages.
@@ -479,6 +476,206 @@ public:
     }
 
 private:
+    //! \brief Solve a single domain with the configured local solve approach.
+    SimulatorReportSingle solveSingleDomain(const Domain& domain,
+                                            SolutionVector& solution,
+                                            SolutionVector& locally_solved,
+                                            DeferredLogger& logger,
+                                            const SimulatorTimerInterface& timer)
+    {
+        SimulatorReportSingle local_report;
+        Dune::Timer detailTimer;
+        detailTimer.start();
+
+        domain_needs_solving_[domain.index] = checkIfSubdomainNeedsSolving(domain);
+
+        updateMobilities(domain);
+
+        if (domain.skip || !domain_needs_solving_[domain.index]) {
+            local_report.skipped_domains = true;
+            local_report.converged = true;
+            return local_report;
+        }
+        switch (model_.param().local_solve_approach_) {
+        case DomainSolveApproach::Jacobi:
+            solveDomainJacobi(solution, locally_solved, local_report, logger,
+                              timer, domain);
+            break;
+        default:
+        case DomainSolveApproach::GaussSeidel:
+            solveDomainGaussSeidel(solution, locally_solved, local_report, logger,
+                                   timer, domain);
+            break;
+        }
+        // This should have updated the global matrix to be
+        // dR_i/du_j evaluated at new local solutions for
+        // i == j, at old solution for i != j.
+        if (!local_report.converged) {
+            // TODO: more proper treatment, including in parallel.
+            logger.debug(fmt::format("Convergence failure in domain {} on rank {}." , domain.index, rank_));
+        }
+        local_report.solver_time += detailTimer.stop();
+        return local_report;
+    }
+
+    //! \brief Whether several domains should be solved concurrently.
+    bool useThreadedDomainSolves() const
+    {
+#ifdef _OPENMP
+        return model_.param().nldd_num_threads_ > 1;
+#else
+        return false;
+#endif
+    }
+
+    //! \brief Solve the domains using a pool of threads.
+    //!
+    //! Domains are processed one color at a time, and all domains of a color
+    //! are solved concurrently. Colors are processed in the order in which
+    //! they first appear in domain_order, so with Gauss-Seidel the color of
+    //! the domain with the largest ordering measure goes first, and
+    //! neighbouring domains in later colors see its update. Log messages are
+    //! collected per domain and appended in domain_order afterwards, so the
+    //! output does not depend on the thread scheduling.
+    void solveDomainsThreaded(const std::vector<int>& domain_order,
+                              SolutionVector& solution,
+                              SolutionVector& locally_solved,
+                              std::vector<SimulatorReportSingle>& domain_reports,
+                              DeferredLogger& logger,
+                              const SimulatorTimerInterface& timer)
+    {
+        OPM_TIMEBLOCK(solveDomainsThreaded);
+        if (domain_colors_.empty()) {
+            this->setupDomainColoring();
+        }
+
+        std::vector<int> color_order;
+        std::vector<std::vector<int>> domains_per_color(num_domain_colors_);
+        for (const int domain_index : domain_order) {
+            const int color = domain_colors_[domain_index];
+            if (domains_per_color[color].empty()) {
+                color_order.push_back(color);
+            }
+            domains_per_color[color].push_back(domain_index);
+        }
+
+        std::vector<DeferredLogger> domain_loggers(domains_.size());
+        std::exception_ptr domain_exception;
+        std::mutex exception_mutex;
+
+#ifdef _OPENMP
+        // Parallel regions nested inside a domain solve (e.g. in the
+        // linearizer) must run on the thread solving that domain, since
+        // only that thread sees the local iteration context.
+        const int max_active_levels = omp_get_max_active_levels();
+        omp_set_max_active_levels(1);
+        const int num_threads = model_.param().nldd_num_threads_;
+#endif
+        for (const int color : color_order) {
+            const auto& color_domains = domains_per_color[color];
+            const int num_color_domains = color_domains.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+#endif
+            for (int ii = 0; ii < num_color_domains; ++ii) {
+                const int domain_index = color_domains[ii];
+                try {
+                    domain_reports[domain_index] =
+                        this->solveSingleDomain(domains_[domain_index], solution,
+                                                locally_solved, domain_loggers[domain_index],
+                                                timer);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(exception_mutex);
+                    if (!domain_exception) {
+                        domain_exception = std::current_exception();
+                    }
+                }
+            }
+            if (domain_exception) {
+                break;
+            }
+        }
+#ifdef _OPENMP
+        omp_set_max_active_levels(max_active_levels);
+#endif
+
+        for (const int domain_index : domain_order) {
+            logger.append(domain_loggers[domain_index]);
+        }
+        if (domain_exception) {
+            std::rethrow_exception(domain_exception);
+        }
+    }
+
+    //! \brief Color the domain adjacency graph.
+    //!
+    //! Two domains are adjacent if the Jacobian couples any of their cells.
+    //! Domains of the same color neither read nor write each other's cells
+    //! during a local solve, and can therefore be solved concurrently.
+    void setupDomainColoring()
+    {
+        OPM_TIMEBLOCK(setupDomainColoring);
+        const auto& matrix = model_.simulator().model().linearizer().jacobian().istlMatrix();
+        const int num_domains = domains_.size();
+
+        std::vector<int> cell_domain(matrix.N(), -1);
+        for (const auto& domain : domains_) {
+            for (const int cell : domain.cells) {
+                cell_domain[cell] = domain.index;
+            }
+        }
+
+        std::vector<std::set<int>> neighbours(num_domains);
+        for (auto row = matrix.begin(); row != matrix.end(); ++row) {
+            const int d1 = cell_domain[row.index()];
+            if (d1 < 0) {
+                continue;
+            }
+            for (auto col = row->begin(); col != row->end(); ++col) {
+                const int d2 = cell_domain[col.index()];
+                if (d2 >= 0) {
+                    neighbours[d1].insert(d2);
+                    neighbours[d2].insert(d1);
+                }
+            }
+        }
+
+        using AdjacencyMatrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, 1, 1>>;
+        std::size_t nnz = 0;
+        for (const auto& nbs : neighbours) {
+            nnz += nbs.size();
+        }
+        AdjacencyMatrix adjacency(num_domains, num_domains, nnz, AdjacencyMatrix::row_wise);
+        for (auto row = adjacency.createbegin(); row != adjacency.createend(); ++row) {
+            for (const int nb : neighbours[row.index()]) {
+                row.insert(nb);
+            }
+        }
+
+        using Graph = Dune::Amg::MatrixGraph<const AdjacencyMatrix>;
+        const Graph graph(adjacency);
+        auto [colors, num_colors, domains_per_color] = colorVerticesWelshPowell(graph);
+        domain_colors_ = std::move(colors);
+        num_domain_colors_ = num_colors;
+
+        if (this->rank_ == 0) {
+            OpmLog::debug(fmt::format("NLDD: {} domains grouped into {} colors for threaded solves.",
+                                      num_domains, num_colors));
+        }
+    }
+
+    //! \brief Run an operation on the well model.
+    //!
+    //! The well model is not thread safe, so calls are serialized when
+    //! several domains are solved concurrently.
+    template <class Func>
+    decltype(auto) withWellModel(Func&& func)
+    {
+        std::lock_guard<std::mutex> lock(well_model_mutex_);
+        return func();
+    }
+
     //! \brief Solve the equation system for a single domain.
     ConvergenceReport
     solveDomain(const Domain& domain,
@@ -502,8 +699,7 @@ private:
             detailTimer.start();
             // TODO: we should have a beginIterationLocal function()
             // only handling the well model for now
-            wellModel_.assemble(modelSimulator.timeStepSize(),
-                                domain);
+            this->withWellModel([&] { wellModel_.assemble(modelSimulator.timeStepSize(), domain); });
             const double tt0 = detailTimer.stop();
             local_report.assemble_time += tt0;
             local_report.assemble_time_well += tt0;
@@ -529,25 +725,25 @@ private:
         // but not done the Schur complement for the wells yet.
         detailTimer.reset();
         detailTimer.start();
-        model_.wellModel().linearizeDomain(domain,
-                                           modelSimulator.model().linearizer().jacobian(),
-                                           modelSimulator.model().linearizer().residual());
+        this->withWellModel([&] {
+            model_.wellModel().linearizeDomain(domain,
+                                               modelSimulator.model().linearizer().jacobian(),
+                                               modelSimulator.model().linearizer().residual());
+        });
         const double tt1 = detailTimer.stop();
         local_report.assemble_time += tt1;
         local_report.assemble_time_well += tt1;
 
         // Local Newton loop.
         const int max_iter = model_.param().max_local_solve_iterations_;
-        const auto& grid = modelSimulator.vanguard().grid();
         double damping_factor = 1.0;
         std::vector<std::vector<Scalar>> convergence_history;
         convergence_history.reserve(20);
         convergence_history.push_back(resnorms);
         do {
             // Solve local linear system.
-            // Note that x has full size, we expect it to be nonzero only for in-domain cells.
-            const int nc = grid.size(0);
-            BVector x(nc);
+            // Note that x is indexed by the domain-local cell index.
+            BVector& x = domain_x_[domain.index];
             detailTimer.reset();
             detailTimer.start();
             double setup_time = 0.0;
@@ -563,13 +759,13 @@ private:
                 local_report.linear_solve_time += detailTimer.stop();
                 local_report.linear_solve_setup_time += setup_time;
                 local_report.total_linear_iterations = domain_linsolvers_[domain.index].iterations();
-                modelSimulator.problem().endIteration();
+                this->withWellModel([&] { modelSimulator.problem().endIteration(); });
                 local_report.converged = false;
                 local_report.total_newton_iterations = localCtx.iteration();
                 local_report.total_linearizations += localCtx.iteration();
                 return convreport;
             }
-            model_.wellModel().postSolveDomain(x, domain);
+            this->withWellModel([&] { model_.wellModel().postSolveDomain(x, domain); });
             if (damping_factor != 1.0) {
                 x *= damping_factor;
             }
@@ -577,7 +773,7 @@ private:
             local_report.linear_solve_setup_time += setup_time;
             local_report.total_linear_iterations = domain_linsolvers_[domain.index].iterations();
 
-            // Update local solution. // TODO: x is still full size, should we optimize it?
+            // Update local solution.
             detailTimer.reset();
             detailTimer.start();
             this->updateDomainSolution(domain, x);
@@ -590,8 +786,7 @@ private:
             // TODO: we should have a beginIterationLocal function()
             // only handling the well model for now
             // Assemble reservoir locally.
-            wellModel_.assemble(modelSimulator.timeStepSize(),
-                                domain);
+            this->withWellModel([&] { wellModel_.assemble(modelSimulator.timeStepSize(), domain); });
             const double tt3 = detailTimer.stop();
             local_report.assemble_time += tt3;
             local_report.assemble_time_well += tt3;
@@ -612,9 +807,11 @@ private:
             // reservoir linearized equations
             detailTimer.reset();
             detailTimer.start();
-            model_.wellModel().linearizeDomain(domain,
-                                               modelSimulator.model().linearizer().jacobian(),
-                                               modelSimulator.model().linearizer().residual());
+            this->withWellModel([&] {
+                model_.wellModel().linearizeDomain(domain,
+                                                   modelSimulator.model().linearizer().jacobian(),
+                                                   modelSimulator.model().linearizer().residual());
+            });
             const double tt2 = detailTimer.stop();
             local_report.assemble_time += tt2;
             local_report.assemble_time_well += tt2;
@@ -633,7 +830,7 @@ private:
             }
         } while (!convreport.converged() && localCtx.iteration() <= max_iter);
 
-        modelSimulator.problem().endIteration();
+        this->withWellModel([&] { modelSimulator.problem().endIteration(); });
 
         local_report.converged = convreport.converged();
         local_report.total_newton_iterations = localCtx.iteration();
@@ -651,7 +848,8 @@ private:
     }
 
     //! \brief Solve the linearized system for a domain.
-    void solveJacobianSystemDomain(const Domain& domain, BVector& global_x, double& setup_time)
+    //! \details The solution x is indexed by the domain-local cell index.
+    void solveJacobianSystemDomain(const Domain& domain, BVector& x, double& setup_time)
     {
         const auto& modelSimulator = model_.simulator();
 
@@ -665,12 +863,11 @@ private:
             domain_matrices_[domain.index] = std::make_unique<Mat>(Details::extractMatrix(main_matrix, domain.cells));
         }
         auto& jac = *domain_matrices_[domain.index];
-        auto res = Details::extractVector(modelSimulator.model().linearizer().residual(),
-                                          domain.cells);
-        auto x = res;
+        auto& res = domain_res_[domain.index];
+        Details::extractVector(modelSimulator.model().linearizer().residual(),
+                               domain.cells, res);
 
         // set initial guess
-        global_x = 0.0;
         x = 0.0;
 
         auto& linsolver = domain_linsolvers_[domain.index];
@@ -679,11 +876,9 @@ private:
         setup_time = perfTimer.stop();
         linsolver.setResidual(res);
         linsolver.solve(x);
-
-        Details::setGlobal(x, domain.cells, global_x);
     }
 
-    /// Apply an update to the primary variables.
+    /// Apply an update, indexed by the domain-local cell index, to the primary variables.
     void updateDomainSolution(const Domain& domain, const BVector& dx)
     {
         OPM_TIMEBLOCK(updateDomainSolution);
@@ -691,13 +886,15 @@ private:
         auto& newtonMethod = simulator.model().newtonMethod();
         SolutionVector& solution = simulator.model().solution(/*timeIdx=*/0);
 
-        newtonMethod.update_(/*nextSolution=*/solution,
-                             /*curSolution=*/solution,
-                             /*update=*/dx,
-                             /*resid=*/dx,
-                             domain.cells); // the update routines of the black
-                                            // oil model do not care about the
-                                            // residual
+        // Counted per domain, as domains may be updated concurrently.
+        domain_num_switched_[domain.index] +=
+            newtonMethod.update_(/*nextSolution=*/solution,
+                                 /*curSolution=*/solution,
+                                 /*update=*/dx,
+                                 /*resid=*/dx,
+                                 domain.cells); // the update routines of the black
+                                                // oil model do not care about the
+                                                // residual
 
         // if the solution is updated, the intensive quantities need to be recalculated
         simulator.model().invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0, domain);
@@ -919,7 +1116,7 @@ private:
                                                           logger,
                                                           B_avg,
                                                           residual_norms);
-        report += wellModel_.getWellConvergence(domain, B_avg, logger);
+        report += this->withWellModel([&] { return wellModel_.getWellConvergence(domain, B_avg, logger); });
         return report;
     }
 
@@ -996,7 +1193,8 @@ private:
                            const SimulatorTimerInterface& timer,
                            const Domain& domain)
     {
-        auto initial_local_well_primary_vars = wellModel_.getPrimaryVarsDomain(domain.index);
+        auto initial_local_well_primary_vars =
+            this->withWellModel([&] { return wellModel_.getPrimaryVarsDomain(domain.index); });
         auto initial_local_solution = Details::extractVector(solution, domain.cells);
         auto convrep = solveDomain(domain, timer, local_report, logger, false);
         if (local_report.converged) {
@@ -1005,7 +1203,7 @@ private:
             Details::setGlobal(initial_local_solution, domain.cells, solution);
             model_.simulator().model().invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0, domain);
         } else {
-            wellModel_.setPrimaryVarsDomain(domain.index, initial_local_well_primary_vars);
+            this->withWellModel([&] { wellModel_.setPrimaryVarsDomain(domain.index, initial_local_well_primary_vars); });
             Details::setGlobal(initial_local_solution, domain.cells, solution);
             model_.simulator().model().invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0, domain);
         }
@@ -1019,7 +1217,8 @@ private:
                                 const SimulatorTimerInterface& timer,
                                 const Domain& domain)
     {
-        auto initial_local_well_primary_vars = wellModel_.getPrimaryVarsDomain(domain.index);
+        auto initial_local_well_primary_vars =
+            this->withWellModel([&] { return wellModel_.getPrimaryVarsDomain(domain.index); });
         auto initial_local_solution = Details::extractVector(solution, domain.cells);
         auto convrep = solveDomain(domain, timer, local_report, logger, true);
         if (!local_report.converged) {
@@ -1061,7 +1260,7 @@ private:
             Details::setGlobal(local_solution, domain.cells, locally_solved);
         } else {
             local_report.unconverged_domains += 1;
-            wellModel_.setPrimaryVarsDomain(domain.index, initial_local_well_primary_vars);
+            this->withWellModel([&] { wellModel_.setPrimaryVarsDomain(domain.index, initial_local_well_primary_vars); });
             Details::setGlobal(initial_local_solution, domain.cells, solution);
             model_.simulator().model().invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0, domain);
         }
@@ -1223,14 +1422,22 @@ private:
     std::vector<Domain> domains_; //!< Vector of subdomains
     std::vector<std::unique_ptr<Mat>> domain_matrices_; //!< Vector of matrix operator for each subdomain
     std::vector<ISTLSolverType> domain_linsolvers_; //!< Vector of linear solvers for each domain
+    std::vector<BVector> domain_res_; //!< Residual buffer for each domain, indexed by domain-local cell
+    std::vector<BVector> domain_x_; //!< Update buffer for each domain, indexed by domain-local cell
     SimulatorReport local_reports_accumulated_; //!< Accumulated convergence report for subdomain solvers per rank
     // mutable because we need to update the number of wells for each domain in getDomainAccumulatedReports()
     mutable std::vector<SimulatorReport> domain_reports_accumulated_; //!< Accumulated convergence reports per domain
     int rank_ = 0; //!< MPI rank of this process
     // Store previous mobilities to check for changes - single flat vector indexed by (globalCellIdx * numActivePhases + activePhaseIdx)
     std::vector<Scalar> previousMobilities_;
-    // Flag indicating if this domain should be solved in the next iteration
-    std::vector<bool> domain_needs_solving_;
+    // Flag indicating if this domain should be solved in the next iteration.
+    // Not std::vector<bool>, as the flags are written concurrently in threaded solves.
+    std::vector<char> domain_needs_solving_;
+    //! Number of primary variable switches in each domain in the current NLDD iteration
+    std::vector<int> domain_num_switched_;
+    std::vector<int> domain_colors_; //!< Color of each domain in the domain adjacency graph
+    int num_domain_colors_ = 0; //!< Number of domain colors
+    std::mutex well_model_mutex_; //!< Serializes well model access in threaded domain solves
 };
 
 } // namespace Opm
@@ -57,6 +57,7 @@ BlackoilModelParameters<Scalar>::BlackoilModelParameters()
     tolerance_well_control_ = Parameters::Get<Parameters::ToleranceWellControl<Scalar>>();
     max_welleq_iter_ = Parameters::Get<Parameters::MaxWelleqIter>();
     use_multisegment_well_ = Parameters::Get<Parameters::UseMultisegmentWell>();
+    threaded_wells_ = Parameters::Get<Parameters::ThreadedWells>();
     tolerance_pressure_ms_wells_ = Parameters::Get<Parameters::TolerancePressureMsWells<Scalar>>();
     relaxed_tolerance_flow_well_ = Parameters::Get<Parameters::RelaxedWellFlowTol<Scalar>>();
     relaxed_tolerance_pressure_ms_well_ = Parameters::Get<Parameters::RelaxedPressureTolMsw<Scalar>>();
@@ -104,6 +105,7 @@ BlackoilModelParameters<Scalar>::BlackoilModelParameters()
     nldd_num_initial_newton_iter_ = Parameters::Get<Parameters::NlddNumInitialNewtonIter>();
     nldd_relative_mobility_change_tol_ = Parameters::Get<Parameters::NlddRelativeMobilityChangeTol<Scalar>>();
     num_local_domains_ = Parameters::Get<Parameters::NumLocalDomains>();
+    nldd_num_threads_ = std::max(1, Parameters::Get<Parameters::NlddNumThreads>());
     local_domains_partition_imbalance_ = std::max(Scalar{1.0}, Parameters::Get<Parameters::LocalDomainsPartitioningImbalance<Scalar>>());
     local_domains_partition_method_ = Parameters::Get<Parameters::LocalDomainsPartitioningMethod>();
     local_domains_partition_well_neighbor_levels_ = Parameters::Get<Parameters::LocalDomainsPartitionWellNeighborLevels>();
@@ -189,6 +191,11 @@ void BlackoilModelParameters<Scalar>::registerParameters()
     Parameters::Register<Parameters::UseMultisegmentWell>
         ("Use the well model for multi-segment wells instead of the "
          "one for single-segment wells");
+    Parameters::Register<Parameters::ThreadedWells>
+        ("Assemble the well equations, apply the well contributions to the "
+         "linear system and compute the well potentials using multiple threads. "
+         "Wells sharing a perforated cell are never assembled or applied at the "
+         "same time");
     Parameters::Register<Parameters::TolerancePressureMsWells<Scalar>>
         ("Tolerance for the pressure equations for multi-segment wells");
     Parameters::Register<Parameters::RelaxedWellFlowTol<Scalar>>
@@ -285,6 +292,11 @@ void BlackoilModelParameters<Scalar>::registerParameters()
         ("Threshold for single cell relative mobility change in the NLDD solver");
     Parameters::Register<Parameters::NumLocalDomains>
         ("Number of local domains for NLDD nonlinear solver.");
+    Parameters::Register<Parameters::NlddNumThreads>
+        ("Number of threads used to solve NLDD subdomains concurrently. "
+         "Only non-neighbouring domains are solved at the same time. "
+         "With gauss-seidel, groups of independent domains are "
+         "processed in the order given by the domain ordering measure.");
     Parameters::Register<Parameters::LocalDomainsPartitioningImbalance<Scalar>>
         ("Subdomain partitioning imbalance tolerance. 1.03 is 3 percent imbalance.");
     Parameters::Register<Parameters::LocalDomainsPartitioningMethod>
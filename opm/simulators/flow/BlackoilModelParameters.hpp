@@ -107,6 +107,7 @@ struct UseUpdateStabilization { static constexpr bool value = true; };
 struct MatrixAddWellContributions { static constexpr bool value = false; };
 
 struct UseMultisegmentWell { static constexpr bool value = true; };
+struct ThreadedWells { static constexpr bool value = false; };
 
 template<class Scalar>
 struct TolerancePressureMsWells { static constexpr Scalar value = 0.01*1e5; };
@@ -169,6 +170,7 @@ struct NlddNumInitialNewtonIter { static constexpr int value = 1; };
 template<class Scalar>
 struct NlddRelativeMobilityChangeTol { static constexpr Scalar value = 0.1; };
 struct NumLocalDomains { static constexpr int value = 0; };
+struct NlddNumThreads { static constexpr int value = 1; };
 
 template<class Scalar>
 struct LocalDomainsPartitioningImbalance { static constexpr Scalar value = 1.03; };
@@ -303,6 +305,10 @@ public:
     /// the default behavoir for the moment. Later, we might set it to be true by default if necessary
     bool use_multisegment_well_;
 
+    /// Whether to assemble and apply the well equations and compute the well
+    /// potentials using multiple threads
+    bool threaded_wells_;
+
     /// The file name of the deck
     std::string deck_file_name_;
 
@@ -380,6 +386,8 @@ public:
     /// Threshold for single cell relative mobility change in NLDD
     Scalar nldd_relative_mobility_change_tol_;
     int num_local_domains_{0};
+    /// Number of threads solving NLDD subdomains concurrently
+    int nldd_num_threads_{1};
     Scalar local_domains_partition_imbalance_{1.03};
     std::string local_domains_partition_method_;
     int local_domains_partition_well_neighbor_levels_{1};
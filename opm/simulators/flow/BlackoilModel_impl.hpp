@@ -358,6 +358,12 @@ nonlinearIterationNewton(const SimulatorTimerInterface& timer,
         // chopping of the update.
         updateSolution(x);
 
+        if constexpr (requires { simulator_.model().takeIntensiveQuantitiesUpdateStatistics(); }) {
+            const auto [updated, skipped] = simulator_.model().takeIntensiveQuantitiesUpdateStatistics();
+            report.updated_intensive_quantities += updated;
+            report.skipped_intensive_quantities += skipped;
+        }
+
         report.update_time += perfTimer.stop();
     }
 
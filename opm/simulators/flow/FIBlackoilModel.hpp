@@ -29,6 +29,7 @@
 #define FI_BLACK_OIL_MODEL_HPP
 
 #include <opm/models/blackoil/blackoilmodel.hh>
+#include <opm/models/utils/parametersystem.hpp>
 #include <opm/models/utils/propertysystem.hh>
 
 #include <opm/common/ErrorMacros.hpp>
@@ -42,9 +43,21 @@
 
 #include <opm/material/fluidmatrixinteractions/EclMultiplexerMaterialParams.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Opm::Parameters {
+
+struct IncrementalIntensiveQuantities { static constexpr bool value = false; };
+template<class Scalar>
+struct IncrementalIntensiveQuantitiesTolerance { static constexpr Scalar value = 0.0; };
+
+} // namespace Opm::Parameters
 
 namespace Opm {
 
@@ -53,6 +66,8 @@ class FIBlackOilModel : public BlackOilModel<TypeTag>
 {
     using ParentType = BlackOilModel<TypeTag>;
     using Simulator = GetPropType<TypeTag, Properties::Simulator>;
+    using Scalar = GetPropType<TypeTag, Properties::Scalar>;
+    using PrimaryVariables = GetPropType<TypeTag, Properties::PrimaryVariables>;
     using IntensiveQuantities = GetPropType<TypeTag, Properties::IntensiveQuantities>;
     using ElementContext = GetPropType<TypeTag, Properties::ElementContext>;
     using ThreadManager = GetPropType<TypeTag, Properties::ThreadManager>;
@@ -78,7 +93,42 @@ public:
         , element_chunks_(this->gridView_,
                           Dune::Partitions::all,
                           ThreadManager::maxThreads())
+        , incremental_(Parameters::Get<Parameters::IncrementalIntensiveQuantities>())
+        , incrementalTolerance_(Parameters::Get<Parameters::IncrementalIntensiveQuantitiesTolerance<Scalar>>())
+    {
+    }
+
+    static void registerParameters()
     {
+        ParentType::registerParameters();
+        Parameters::Register<Parameters::IncrementalIntensiveQuantities>
+            ("Within a time step, only update the intensive quantities of cells whose "
+             "primary variables changed since their last update.");
+        Parameters::Register<Parameters::IncrementalIntensiveQuantitiesTolerance<Scalar>>
+            ("Relative change of the primary variables below which the intensive quantities "
+             "of a cell are not updated with --incremental-intensive-quantities. "
+             "With zero only the cells without any change are skipped. A positive value "
+             "trades accuracy for speed: the residual and the convergence check then use "
+             "intensive quantities which lag behind the primary variables, which may "
+             "change the number of Newton iterations and the converged solution.");
+    }
+
+    /*!
+     * \brief Number of actual updates of the cached intensive quantities of each cell.
+     *
+     * Only maintained with --incremental-intensive-quantities=true, and empty
+     * otherwise. Quantities depending only on the intensive quantities of cells
+     * whose counters did not change since they were computed are still valid.
+     */
+    const std::vector<unsigned>& intensiveQuantitiesVersions() const
+    { return iqVersions_; }
+
+    /*!
+     * \brief Return and reset the number of updated and skipped cells since the last call.
+     */
+    std::pair<std::size_t, std::size_t> takeIntensiveQuantitiesUpdateStatistics() const
+    {
+        return {std::exchange(numUpdated_, 0), std::exchange(numSkipped_, 0)};
     }
 
     void invalidateAndUpdateIntensiveQuantities(unsigned timeIdx) const
@@ -89,6 +139,7 @@ public:
                 updateCachedIntQuants(timeIdx);
                 return;
             }
+            resetIncrementalState_(timeIdx);
             OPM_BEGIN_PARALLEL_TRY_CATCH();
 #ifdef _OPENMP
 #pragma omp parallel for
@@ -103,6 +154,7 @@ public:
             OPM_END_PARALLEL_TRY_CATCH("invalidateAndUpdateIntensiveQuantities: state error",
                                        this->simulator_.vanguard().grid().comm());
         } else {
+            resetIncrementalState_(timeIdx);
             // Grid is possibly refined or otherwise changed between calls.
             ElementContext elemCtx(this->simulator_);
             for (const auto& elem : elements(this->gridView_)) {
@@ -137,6 +189,9 @@ public:
                 }
                 // Update for this element.
                 elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+                for (unsigned dofIdx = 0; dofIdx < numPrimaryDof; ++dofIdx) {
+                    recordUpdate_(elemCtx.globalSpaceIndex(dofIdx, timeIdx), timeIdx);
+                }
             }
         }
         OPM_END_PARALLEL_TRY_CATCH("InvalideAndUpdateIntensiveQuantitiesOverlap: state error",
@@ -146,6 +201,8 @@ public:
     template <class GridSubDomain>
     void invalidateAndUpdateIntensiveQuantities(unsigned timeIdx, const GridSubDomain& gridSubDomain) const
     {
+        // Only the cells of the subdomain are touched, also in the incremental
+        // state, as subdomains may be updated concurrently.
         // loop over all elements in the subdomain
         using GridViewType = decltype(gridSubDomain.view);
         ThreadedEntityIterator<GridViewType, /*codim=*/0> threadedElemIt(gridSubDomain.view);
@@ -169,25 +226,13 @@ public:
                 }
                 // Update for this element.
                 elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+                for (unsigned dofIdx = 0; dofIdx < numPrimaryDof; ++dofIdx) {
+                    recordUpdate_(elemCtx.globalSpaceIndex(dofIdx, timeIdx), timeIdx);
+                }
             }
         }
     }
 
-    /*!
-     * \brief Called by the update() method if it was
-     *        unsuccessful. This is primary a hook which the actual
-     *        model can overload.
-     */
-    void updateFailed()
-    {
-        // Reset the current solution to the one of the
-        // previous time step so that we can start the next
-        // update at a physically meaningful solution.
-        // this->solution(/*timeIdx=*/0) = this->solution(/*timeIdx=*/1);
-        ParentType::updateFailed();
-        invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0);
-    }
-
     // standard flow
     const IntensiveQuantities& intensiveQuantities(unsigned globalIdx, unsigned timeIdx) const
     {
@@ -253,15 +298,116 @@ protected:
     template <class ...Args>
     void updateCachedIntQuantsLoop(const unsigned timeIdx) const
     {
+        const bool incremental = prepareIncrementalUpdate_(timeIdx);
+        std::size_t numSkipped = 0;
+
         const auto& elementMapper = this->simulator_.model().elementMapper();
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for reduction(+:numSkipped)
 #endif
         for (const auto& chunk : element_chunks_) {
             for (const auto& elem : chunk) {
-                this->template updateSingleCachedIntQuantUnchecked<Args...>(elementMapper.index(elem), timeIdx);
+                numSkipped += this->template updateCachedIntQuant_<Args...>(elementMapper.index(elem),
+                                                                           timeIdx, incremental);
             }
         }
+        countUpdates_(this->intensiveQuantityCache_[timeIdx].size(), numSkipped, timeIdx);
+    }
+
+    // Update the cached intensive quantities of a cell, unless the incremental
+    // mode is active and its primary variables did not change. Returns whether
+    // the update was skipped.
+    template <class ...Args>
+    bool updateCachedIntQuant_(const unsigned globalIdx, const unsigned timeIdx, const bool incremental) const
+    {
+        if (incremental && primaryVariablesUnchanged_(globalIdx)) {
+            this->intensiveQuantityCacheUpToDate_[timeIdx][globalIdx] = 1;
+            return true;
+        }
+        this->template updateSingleCachedIntQuantUnchecked<Args...>(globalIdx, timeIdx);
+        recordUpdate_(globalIdx, timeIdx);
+        return false;
+    }
+
+    // Record that the intensive quantities of a cell were computed from its
+    // current primary variables. Only touches the data of that cell.
+    void recordUpdate_(const unsigned globalIdx, const unsigned timeIdx) const
+    {
+        if (!incremental_ || timeIdx != 0 || globalIdx >= lastUpdatePrimaryVars_.size()) {
+            return;
+        }
+        lastUpdatePrimaryVars_[globalIdx] = this->solution(timeIdx)[globalIdx];
+        ++iqVersions_[globalIdx];
+    }
+
+    // Set up the incremental state, and return whether cells may be skipped.
+    // The first update of a time step, and updates in local solves, are full.
+    bool prepareIncrementalUpdate_(const unsigned timeIdx) const
+    {
+        if (!incremental_ || timeIdx != 0) {
+            return false;
+        }
+        const std::size_t numCells = this->intensiveQuantityCache_[0].size();
+        if (lastUpdatePrimaryVars_.size() != numCells) {
+            lastUpdatePrimaryVars_.resize(numCells);
+            iqVersions_.resize(numCells, 0);
+            return false;
+        }
+        const auto& iterCtx = this->simulator_.problem().iterationContext();
+        return iterCtx.timestepInitialized() &&
+            !iterCtx.isFirstGlobalIteration() &&
+            !iterCtx.inLocalSolve();
+    }
+
+    // With a positive tolerance, small changes are accepted without an update.
+    // The change is measured against the primary variables of the last actual
+    // update, so the lag of the intensive quantities stays below the tolerance,
+    // but the residual is then not exact. The default tolerance of zero only
+    // skips cells which are exactly unchanged.
+    bool primaryVariablesUnchanged_(const unsigned globalIdx) const
+    {
+        const PrimaryVariables& pv = this->solution(/*timeIdx=*/0)[globalIdx];
+        const PrimaryVariables& last = lastUpdatePrimaryVars_[globalIdx];
+        if (pv.primaryVarsMeaningWater() != last.primaryVarsMeaningWater() ||
+            pv.primaryVarsMeaningPressure() != last.primaryVarsMeaningPressure() ||
+            pv.primaryVarsMeaningGas() != last.primaryVarsMeaningGas() ||
+            pv.primaryVarsMeaningBrine() != last.primaryVarsMeaningBrine() ||
+            pv.primaryVarsMeaningSolvent() != last.primaryVarsMeaningSolvent() ||
+            pv.pvtRegionIndex() != last.pvtRegionIndex())
+        {
+            return false;
+        }
+        if (incrementalTolerance_ <= 0.0) {
+            return pv == last;
+        }
+        for (unsigned eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+            const Scalar scale = std::max(Scalar{1}, std::abs(last[eqIdx]));
+            if (std::abs(pv[eqIdx] - last[eqIdx]) > incrementalTolerance_ * scale) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void countUpdates_(const std::size_t numCells, const std::size_t numSkipped, const unsigned timeIdx) const
+    {
+        if (incremental_ && timeIdx == 0) {
+            numUpdated_ += numCells - numSkipped;
+            numSkipped_ += numSkipped;
+        }
+    }
+
+    // Updates which do not go through updateCachedIntQuant_() make the next
+    // update a full one, and invalidate everything derived from the quantities.
+    void resetIncrementalState_(const unsigned timeIdx) const
+    {
+        if (!incremental_ || timeIdx != 0) {
+            return;
+        }
+        lastUpdatePrimaryVars_.clear();
+        for (auto& version : iqVersions_) {
+            ++version;
+        }
     }
 
     template <class ...Args>
@@ -276,6 +422,13 @@ protected:
     }
 
     ElementChunks<GridView, Dune::Partitions::All> element_chunks_;
+
+    bool incremental_ = false;
+    Scalar incrementalTolerance_ = 0.0;
+    mutable std::vector<PrimaryVariables> lastUpdatePrimaryVars_;
+    mutable std::vector<unsigned> iqVersions_;
+    mutable std::size_t numUpdated_ = 0;
+    mutable std::size_t numSkipped_ = 0;
 };
 
 } // namespace Opm
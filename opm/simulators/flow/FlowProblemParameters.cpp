@@ -80,6 +80,9 @@ void registerFlowProblemParameters()
     Parameters::Register<Parameters::ConserveInnerEnergyThermal>
         ("Conserve inner energy and not enthalpy "
          "even if THERMAL is used.");
+    Parameters::Register<Parameters::EnableFluxOrderedTracerSolver>
+        ("Solve the tracer transport by ordering the cells along the flow, "
+         "only iterating on circulation cycles. Only used in serial runs.");
 
     // By default, stop it after the universe will probably have stopped
     // to exist. (the ECL problem will finish the simulation explicitly
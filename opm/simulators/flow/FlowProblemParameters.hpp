@@ -69,6 +69,10 @@ struct UseHybridNewton { static constexpr bool value = false; };
 // Conserve inner energy instead of enthalpy even if THERMAL is used
 struct ConserveInnerEnergyThermal { static constexpr bool value = false; };
 
+// Solve the tracer transport directly in the order of the flow, iterating
+// only on cells connected by circulation cycles
+struct EnableFluxOrderedTracerSolver { static constexpr bool value = false; };
+
 } // namespace Opm::Parameters
 
 namespace Opm {
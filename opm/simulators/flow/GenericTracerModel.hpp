@@ -169,6 +169,9 @@ protected:
 
     /// \brief Function returning the cell centers
     std::function<std::array<double,dimWorld>(int)> centroids_;
+
+    /// \brief Whether to solve in flow order before falling back to Krylov
+    bool fluxOrderedSolver_ = false;
 };
 
 } // namespace Opm
@@ -50,6 +50,8 @@
 #include <opm/simulators/linalg/ilufirstelement.hh>
 #include <opm/simulators/linalg/PropertyTree.hpp>
 #include <opm/simulators/linalg/FlexibleSolver.hpp>
+#include <opm/simulators/linalg/FluxOrderedSolver.hpp>
+#include <opm/simulators/linalg/MultiRhsBiCGSTAB.hpp>
 
 #include <fmt/format.h>
 
@@ -446,11 +448,11 @@ linearSolveBatchwise_(const TracerMatrix& M, std::vector<TracerVector>& x, std::
     OPM_TIMEBLOCK(tracerSolve);
     const Scalar tolerance = 1e-2;
     const int maxIter = 100;
-    const int verbosity = 0;
 
 #if HAVE_MPI
     if (gridView_.grid().comm().size() > 1)
     {
+        const int verbosity = 0;
         PropertyTree prm;
         prm.put("maxiter", maxIter);
         prm.put("tol", tolerance);
@@ -472,34 +474,32 @@ linearSolveBatchwise_(const TracerMatrix& M, std::vector<TracerVector>& x, std::
     else
 #endif
     {
-        using TracerSolver = Dune::BiCGSTABSolver<TracerVector>;
-        using TracerOperator = Dune::MatrixAdapter<TracerMatrix,TracerVector,TracerVector>;
-        using TracerScalarProduct = Dune::SeqScalarProduct<TracerVector>;
-        using TracerPreconditioner = Dune::SeqILU<TracerMatrix,TracerVector,TracerVector>;
-
         if (std::ranges::all_of(b, [](const auto& v) { return v.infinity_norm() == 0.0; }))
         {
             return true;
         }
 
-        TracerOperator tracerOperator(M);
-        TracerScalarProduct tracerScalarProduct;
-        TracerPreconditioner tracerPreconditioner(M, 0, 1); // results in ILU0
-
-        TracerSolver solver (tracerOperator, tracerScalarProduct,
-                             tracerPreconditioner, tolerance, maxIter,
-                             verbosity);
+        for (auto& xi : x) {
+            xi = 0.0;
+        }
 
-        bool converged = true;
-        for (std::size_t nrhs = 0; nrhs < b.size(); ++nrhs) {
-            x[nrhs] = 0.0;
-            Dune::InverseOperatorResult result;
-            solver.apply(x[nrhs], b[nrhs], result);
-            converged = (converged && result.converged);
+        if (fluxOrderedSolver_) {
+            // Upwinding makes the matrix triangular in flow order, apart from
+            // circulation cycles. If a cycle is not resolved within a few
+            // sweeps, the partial solution is the initial guess for Krylov.
+            const int maxSweeps = 20;
+            FluxOrderedSolver<TracerMatrix, TracerVector> ordered(M, tolerance, maxSweeps);
+            if (ordered.apply(x, b)) {
+                return true;
+            }
         }
 
+        // All tracers of the batch share the matrix, so the products and
+        // ILU0 applications of all right-hand sides are done in one sweep.
+        MultiRhsBiCGSTAB<TracerMatrix, TracerVector> solver(M, tolerance, maxIter);
+
         // return the result of the solver
-        return converged;
+        return solver.apply(x, b);
     }
 }
 
@@ -23,12 +23,22 @@
 #define HYBRID_NEWTON_HPP
 
 
+#include <opm/common/OpmLog/OpmLog.hpp>
+
 #include <opm/simulators/flow/FlowBaseProblemProperties.hpp>
 #include <opm/simulators/flow/HybridNewtonConfig.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
 #include <opm/ml/ml_model.hpp>
 
+#include <dune/common/timer.hh>
+
+#include <fmt/format.h>
+
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -53,6 +63,11 @@ namespace Opm {
  *   2. Constructs an input tensor [n_cells x n_input_features],
  *   3. Runs the ML model to produce an output tensor [n_cells x n_output_features],
  *   4. Updates the nonlinear solver’s initial guess accordingly.
+ *
+ * Each model file is loaded once and kept for later applications, and the
+ * tensors of each configuration are allocated once. Inference works on plain
+ * Scalar values, since no derivatives are needed. Feature extraction and the
+ * update of the initial guess are threaded over the cells.
  */
 template <typename TypeTag>
 class BlackOilHybridNewton
@@ -110,6 +125,8 @@ public:
             for (const auto& model_key : pt.get_child_keys()) {
                 HybridNewtonConfig config(pt.get_child(model_key));
                 config.validateConfig(compositionSwitchEnabled);
+                inputs_.emplace_back(inputTensorLength(config));
+                outputs_.emplace_back(1, config.n_cells * config.output_features.size());
                 configs_.push_back(std::move(config));
             }
             configsLoaded_ = true;
@@ -117,9 +134,9 @@ public:
 
         Scalar current_time = simulator_.time();
         // Find and apply all models that should run at this time
-        for (const auto& config : configs_) {
-            if (shouldApplyHybridNewton(current_time, config)) {
-                runHybridNewton(config);
+        for (std::size_t i = 0; i < configs_.size(); ++i) {
+            if (shouldApplyHybridNewton(current_time, configs_[i])) {
+                runHybridNewton(configs_[i], inputs_[i], outputs_[i]);
             }
         }
     }
@@ -128,22 +145,32 @@ private:
     /*!
     * \brief Apply the Hybrid Newton method using a given model configuration.
     *
-    * This function loads the cell indices on demand from the configuration's
-    * `cell_indices_file`, constructs the input tensor, evaluates the model to
+    * This function constructs the input tensor, evaluates the model to
     * produce the output tensor, and applies the result to update the initial
-    * guess of the nonlinear solver.
+    * guess of the nonlinear solver. The time spent is logged per application.
     *
     * \param config The HybridNewtonConfig object containing model path,
-    *        feature specifications, and cell indices file reference.
+    *        feature specifications, and cell indices.
+    * \param input Input tensor of the configuration.
+    * \param output Output tensor of the configuration.
     *
-    * \throws std::runtime_error if cell indices cannot be loaded or if
-    *         feature extraction or application fails.
+    * \throws std::runtime_error if feature extraction or application fails.
     */
-    void runHybridNewton(const HybridNewtonConfig& config)
+    void runHybridNewton(const HybridNewtonConfig& config,
+                         ML::Tensor<Scalar>& input,
+                         ML::Tensor<Scalar>& output)
     {
-        auto input  = constructInputTensor(config);
-        auto output = constructOutputTensor(input, config);
+        Dune::Timer timer;
+        constructInputTensor(config, input);
+        const double inputTime = timer.elapsed();
+        constructOutputTensor(input, output, config);
+        const double inferenceTime = timer.elapsed() - inputTime;
         updateInitialGuess(output, config);
+        OpmLog::debug(fmt::format("HybridNewton: applied {} to {} cells in {:.6f} s "
+                                  "(input {:.6f} s, inference {:.6f} s, update {:.6f} s)",
+                                  config.model_path, config.n_cells, timer.elapsed(),
+                                  inputTime, inferenceTime,
+                                  timer.elapsed() - inputTime - inferenceTime));
     }
 
 protected:
@@ -227,46 +254,35 @@ protected:
     *     (# of scalar features) + (# of per-cell features × n_cells).
     *
     * \param config  HybridNewtonConfig containing feature definitions and cell indices.
-    * \return        A 1D tensor of Evaluation values with the computed layout.
+    * \param input   Tensor of length inputTensorLength(config), filled in
+    *                with the computed layout.
     */
-    ML::Tensor<Evaluation>
-    constructInputTensor(const HybridNewtonConfig& config)
+    void constructInputTensor(const HybridNewtonConfig& config,
+                              ML::Tensor<Scalar>& input)
     {
-        const auto& features = config.input_features;
-
-        // compute total length directly
-        std::size_t input_tensor_length = 0;
-        for (const auto& feature : features) {
-            const FeatureSpec& spec = feature.second;
-            if (spec.actual_name == "TIMESTEP") {
-                input_tensor_length += 1;
-            } else {
-                input_tensor_length += config.n_cells;
-            }
-        }
-
-        ML::Tensor<Evaluation> input(input_tensor_length);
         std::size_t offset = 0;
 
         // fill in exact feature order from config
-        for (const auto& feature: features) {
+        for (const auto& feature: config.input_features) {
             const FeatureSpec& spec = feature.second;
 
             if (spec.actual_name == "TIMESTEP") {
-                auto value = static_cast<Evaluation>(getScalarFeatureValue(spec));
-                input(offset++) = value;
+                input(offset++) = getScalarFeatureValue(spec);
             } else {
-                for (std::size_t i = 0; i < config.n_cells; ++i) {
-                    auto value = static_cast<Evaluation>(
-                        getPerCellFeatureValue(spec, config.cell_indices[i])
-                    );
-                    input(offset + i) = value;
-                }
+                constructPerCellFeature(spec, config, input, offset);
                 offset += config.n_cells;
             }
         }
+    }
 
-        return input;
+    //! \brief Length of the input tensor of a configuration.
+    static std::size_t inputTensorLength(const HybridNewtonConfig& config)
+    {
+        std::size_t length = 0;
+        for (const auto& feature : config.input_features) {
+            length += feature.second.actual_name == "TIMESTEP" ? 1 : config.n_cells;
+        }
+        return length;
     }
 
     /*!
@@ -297,24 +313,87 @@ protected:
         return spec.scaler.scale(value);
     }
 
+    //! \brief Per-cell features, resolved from their name once per feature.
+    enum class CellFeature { Pressure, Swat, Soil, Sgas, Rs, Rv, Permx };
+
+    /*!
+    * \brief Resolve the name of a per-cell feature.
+    *
+    * \throws std::runtime_error if the feature is unknown.
+    */
+    static CellFeature cellFeature(const std::string& name)
+    {
+        if (name == "PRESSURE") {
+            return CellFeature::Pressure;
+        } else if (name == "SWAT") {
+            return CellFeature::Swat;
+        } else if (name == "SOIL") {
+            return CellFeature::Soil;
+        } else if (name == "SGAS") {
+            return CellFeature::Sgas;
+        } else if (name == "RS") {
+            return CellFeature::Rs;
+        } else if (name == "RV") {
+            return CellFeature::Rv;
+        } else if (name == "PERMX") {
+            return CellFeature::Permx;
+        }
+        OPM_THROW(std::runtime_error, "Unknown per-cell feature: " + name);
+    }
+
     /*!
-    * \brief Retrieve and transform a per-cell feature value.
+    * \brief Retrieve, transform and store a per-cell feature for all cells.
     *
     * Supported per-cell features include:
     *   - PRESSURE, SWAT, SOIL, SGAS, RS, RV, PERMX.
     *
+    * The cells are processed in parallel.
+    *
+    * \param spec The feature specification, including transform and scaling.
+    * \param config The configuration holding the cell indices.
+    * \param input The input tensor to store the values in.
+    * \param offset Position of the value of the first cell in \p input.
+    *
+    * \throws std::runtime_error if the feature is unknown.
+    */
+    void constructPerCellFeature(const FeatureSpec& spec,
+                                 const HybridNewtonConfig& config,
+                                 ML::Tensor<Scalar>& input,
+                                 const std::size_t offset)
+    {
+        const CellFeature feature = cellFeature(spec.actual_name);
+
+        // Fetch the field property once, not once per cell.
+        std::vector<double> permX;
+        if (feature == CellFeature::Permx) {
+            permX = simulator_.vanguard().eclState().fieldProps().get_double("PERMX");
+        }
+
+        parallelForCells(config.n_cells, [&](const std::size_t i)
+        {
+            input(offset + i) = getPerCellFeatureValue(spec, feature,
+                                                       config.cell_indices[i], permX);
+        });
+    }
+
+    /*!
+    * \brief Retrieve and transform a per-cell feature value.
+    *
     * The raw value is taken from the simulator state,
     * converted into the configured unit system,
     * then passed through the feature's transformation
     * and scaling functions.
     *
     * \param spec The feature specification, including transform and scaling.
+    * \param feature The resolved feature of \p spec.
     * \param cell_index The cell index for which to retrieve the value.
+    * \param permX The PERMX field property, only used for that feature.
     * \return The transformed and scaled feature value.
-    *
-    * \throws std::runtime_error if the feature is unknown.
     */
-    Scalar getPerCellFeatureValue(const FeatureSpec& spec, int cell_index)
+    Scalar getPerCellFeatureValue(const FeatureSpec& spec,
+                                  const CellFeature feature,
+                                  int cell_index,
+                                  const std::vector<double>& permX) const
     {
         const auto& intQuants = simulator_.model().intensiveQuantities(cell_index, 0);
         const auto& fs = intQuants.fluidState();
@@ -322,29 +401,32 @@ protected:
 
         Scalar value = 0.0;
 
-        if (spec.actual_name == "PRESSURE") {
+        switch (feature) {
+        case CellFeature::Pressure:
             value = getValue(fs.pressure(oilPhaseIdx));
             value = unitSyst.from_si(UnitSystem::measure::pressure, value);
-        } else if (spec.actual_name == "SWAT") {
+            break;
+        case CellFeature::Swat:
             value = getValue(fs.saturation(waterPhaseIdx));
-        } else if (spec.actual_name == "SGAS") {
+            break;
+        case CellFeature::Sgas:
             value = getValue(fs.saturation(gasPhaseIdx));
-        } else if (spec.actual_name == "SOIL") {
+            break;
+        case CellFeature::Soil:
             value = getValue(fs.saturation(oilPhaseIdx));
-        } else if (spec.actual_name == "RS") {
+            break;
+        case CellFeature::Rs:
             value = getValue(fs.Rs());
             value = unitSyst.from_si(UnitSystem::measure::gas_oil_ratio, value);
-        } else if (spec.actual_name == "RV") {
+            break;
+        case CellFeature::Rv:
             value = getValue(fs.Rv());
             value = unitSyst.from_si(UnitSystem::measure::oil_gas_ratio, value);
-        } else if (spec.actual_name == "PERMX") {
-            const auto& eclState = simulator_.vanguard().eclState();
-            const auto& fp = eclState.fieldProps();
-            auto permX = fp.get_double("PERMX");
+            break;
+        case CellFeature::Permx:
             value = permX[cell_index];
             value = unitSyst.from_si(UnitSystem::measure::permeability, value);
-        } else {
-            OPM_THROW(std::runtime_error, "Unknown per-cell feature: " + spec.actual_name);
+            break;
         }
 
         Scalar transformed = spec.transform.apply(value);
@@ -352,6 +434,36 @@ protected:
         return scaled;
     }
 
+    /*!
+    * \brief Calls \p func for the positions 0 to n - 1, in parallel.
+    *
+    * An exception thrown for any position is rethrown after the loop.
+    */
+    template <class Func>
+    static void parallelForCells(const std::size_t n, Func&& func)
+    {
+        std::exception_ptr exception;
+        std::mutex exceptionMutex;
+        const int numCells = n;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < numCells; ++i) {
+            try {
+                func(static_cast<std::size_t>(i));
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
 
     /*!
     * \brief Run the Hybrid Newton model to produce output predictions.
@@ -363,28 +475,36 @@ protected:
     *
     * \param input The input tensor of shape
     *              [(# of scalar features) + (# of per-cell features × n_cells)].
+    * \param output The output tensor of shape [n_cells x n_output_features],
+    *               where rows correspond to cells and columns correspond to
+    *               output features.
     * \param config The HybridNewtonConfig specifying model path and output
     *        feature definitions.
-    * \return A tensor of shape [n_cells x n_output_features], where rows
-    *         correspond to cells and columns correspond to output features.
     *
     * \throws std::runtime_error if model inference fails or if the
     *         output tensor does not match the expected feature layout.
     */
-    ML::Tensor<Evaluation>
-    constructOutputTensor(const ML::Tensor<Evaluation>& input,
-                          const HybridNewtonConfig& config)
+    void constructOutputTensor(const ML::Tensor<Scalar>& input,
+                               ML::Tensor<Scalar>& output,
+                               const HybridNewtonConfig& config)
     {
-        const auto& features = config.output_features;
-        const int n_features = features.size();
-
-        ML::NNModel<Evaluation> model;
-        model.loadModel(config.model_path);
-
-        ML::Tensor<Evaluation> output(1, config.n_cells * n_features);
-        model.apply(input, output);
+        loadedModel(config.model_path).apply(input, output);
+    }
 
-        return output;
+    /*!
+    * \brief Return the model stored in a file, loading it on first use.
+    *
+    * \param path Path to the model file.
+    */
+    ML::NNModel<Scalar>& loadedModel(const std::string& path)
+    {
+        auto& model = models_[path];
+        if (!model) {
+            auto loaded = std::make_unique<ML::NNModel<Scalar>>();
+            loaded->loadModel(path);
+            model = std::move(loaded);
+        }
+        return *model;
     }
 
     /*!
@@ -414,7 +534,7 @@ protected:
     * \throws std::runtime_error if an unknown output feature is encountered
     *         or if state consistency cannot be enforced.
     */
-    void updateInitialGuess(ML::Tensor<Evaluation>& output,
+    void updateInitialGuess(ML::Tensor<Scalar>& output,
                             const HybridNewtonConfig& config)
     {
         const auto& features = config.output_features;
@@ -423,7 +543,9 @@ protected:
 
         const auto& unitSyst = simulator_.vanguard().schedule().getUnits();
 
-        for (std::size_t i = 0; i < config.n_cells; ++i) {
+        // Each cell only updates its own state, so the cells are processed in parallel.
+        parallelForCells(config.n_cells, [&](const std::size_t i)
+        {
             const int cell_idx = config.cell_indices[i];
             const auto& intQuants = simulator_.model().intensiveQuantities(cell_idx, /*timeIdx*/0);
             auto fs = intQuants.fluidState();
@@ -438,7 +560,7 @@ protected:
 
             for (const auto& [name, spec] : features) {
 
-                auto scaled_value = getValue(output(feature_idx * config.n_cells + i));
+                Scalar scaled_value = output(feature_idx * config.n_cells + i);
 
                 // Inverse scaling
                 Scalar raw_value = spec.scaler.unscale(scaled_value);
@@ -537,7 +659,7 @@ protected:
 
             auto& primaryVars = simulator_.model().solution(/*timeIdx*/0)[cell_idx];
             primaryVars.assignNaive(fs);
-        }
+        });
 
         simulator_.model().invalidateAndUpdateIntensiveQuantities(/*timeIdx*/0);
     }
@@ -573,6 +695,9 @@ protected:
 protected:
     Simulator& simulator_;
     std::vector<HybridNewtonConfig> configs_;
+    std::vector<ML::Tensor<Scalar>> inputs_; //!< Input tensor of each configuration
+    std::vector<ML::Tensor<Scalar>> outputs_; //!< Output tensor of each configuration
+    std::map<std::string, std::unique_ptr<ML::NNModel<Scalar>>> models_; //!< Loaded models by path
     bool configsLoaded_;
 };
 
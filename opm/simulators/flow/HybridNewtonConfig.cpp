@@ -29,6 +29,7 @@
 #include <algorithm>
 #include <fstream>
 #include <stdexcept>
+#include <unordered_set>
 
 namespace Opm {
 
@@ -106,16 +107,26 @@ HybridNewtonConfig::loadCellIndicesFromFile(const std::string& filename) const
         throw std::runtime_error("Cannot open cell indices file: " + filename);
     }
 
+    // The initial guess is updated for all indices in parallel, so each
+    // cell may only be listed once.
+    std::unordered_set<int> seen;
     std::string line;
     int lineNumber = 0;
     while (std::getline(cellFile, line)) {
         ++lineNumber;
         if (line.empty() || line[0] == '#') continue;
-        try { indices.push_back(std::stoi(line)); }
+        int index = 0;
+        try { index = std::stoi(line); }
         catch (...) {
             throw std::runtime_error("Invalid cell index at line " + std::to_string(lineNumber) +
                                      " in file " + filename + ": " + line);
         }
+        if (!seen.insert(index).second) {
+            throw std::runtime_error("Duplicate cell index " + std::to_string(index) +
+                                     " at line " + std::to_string(lineNumber) +
+                                     " in file " + filename);
+        }
+        indices.push_back(index);
     }
 
     if (indices.empty()) {
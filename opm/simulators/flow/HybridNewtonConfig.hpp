@@ -171,7 +171,8 @@ private:
     * \brief Load cell indices from a plain text file.
     *
     * Each line must contain one integer index. Lines starting with '#' or
-    * empty lines are ignored. Throws if the file is missing, invalid, or empty.
+    * empty lines are ignored. Throws if the file is missing, invalid, or empty,
+    * or if an index is listed more than once.
     */
     std::vector<int> loadCellIndicesFromFile(const std::string& filename) const;
 
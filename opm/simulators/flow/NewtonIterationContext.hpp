@@ -22,6 +22,10 @@
 
 #include <cassert>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace Opm {
 
 /// \brief Context for iteration-dependent decisions in the Newton solver.
@@ -148,19 +152,33 @@ private:
 /// RAII guard for NLDD domain-local iteration context.
 /// Saves the current context on the problem, installs a local-solve
 /// context, and restores the original on destruction.
+///
+/// When constructed inside an OpenMP parallel region (several domains
+/// solved concurrently), the local context is installed for the calling
+/// thread only and the shared context of the problem is left untouched.
 template<class Problem>
 class LocalContextGuard {
 public:
     LocalContextGuard(Problem& problem)
         : problem_(problem)
         , saved_(problem.iterationContext())
+        , threadLocal_(inParallelRegion())
     {
-        problem_.mutableIterationContext() = saved_.forLocalSolve();
+        if (threadLocal_) {
+            local_ = saved_.forLocalSolve();
+            Problem::setThreadLocalIterationContext(&local_);
+        } else {
+            problem_.mutableIterationContext() = saved_.forLocalSolve();
+        }
     }
 
     ~LocalContextGuard()
     {
-        problem_.mutableIterationContext() = saved_;
+        if (threadLocal_) {
+            Problem::setThreadLocalIterationContext(nullptr);
+        } else {
+            problem_.mutableIterationContext() = saved_;
+        }
     }
 
     LocalContextGuard(const LocalContextGuard&) = delete;
@@ -172,8 +190,19 @@ public:
     const NewtonIterationContext& context() const { return problem_.iterationContext(); }
 
 private:
+    static bool inParallelRegion()
+    {
+#ifdef _OPENMP
+        return omp_in_parallel();
+#else
+        return false;
+#endif
+    }
+
     Problem& problem_;
     NewtonIterationContext saved_;
+    NewtonIterationContext local_;
+    bool threadLocal_;
 };
 
 } // namespace Opm
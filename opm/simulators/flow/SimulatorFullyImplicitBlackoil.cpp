@@ -54,6 +54,12 @@ void registerSimulatorParameters()
         ("FileName for .OPMRST file used for saving serialized state. "
          "If empty, CASENAME.OPMRST is used.");
     Parameters::Hide<Parameters::SaveFile>();
+    Parameters::Register<Parameters::SaveAsync>
+        ("Write serialized state on a background thread while the simulation "
+         "continues. Only used in serial runs.");
+    Parameters::Register<Parameters::SaveIncremental>
+        ("Only write the parts of the serialized state which changed since the "
+         "previous save to the same .OPMRST file.");
     Parameters::Register<Parameters::LoadFile>
         ("FileName for .OPMRST file used to load serialized state. "
          "If empty, CASENAME.OPMRST is used.");
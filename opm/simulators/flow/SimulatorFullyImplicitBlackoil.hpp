@@ -56,6 +56,7 @@
 #include <opm/simulators/wells/WellState.hpp>
 
 #if HAVE_HDF5
+#include <opm/simulators/utils/HDF5Checkpoint.hpp>
 #include <opm/simulators/utils/HDF5Serializer.hpp>
 #endif
 
@@ -74,6 +75,8 @@ struct EnableAdaptiveTimeStepping { static constexpr bool value = true; };
 struct OutputExtraConvergenceInfo { static constexpr auto* value = "none"; };
 struct SaveStep { static constexpr auto* value = ""; };
 struct SaveFile { static constexpr auto* value = ""; };
+struct SaveAsync { static constexpr bool value = false; };
+struct SaveIncremental { static constexpr bool value = false; };
 struct LoadFile { static constexpr auto* value = ""; };
 struct LoadStep { static constexpr int value = -1; };
 struct Slave { static constexpr bool value = false; };
@@ -127,7 +130,9 @@ public:
                       Parameters::Get<Parameters::SaveStep>(),
                       Parameters::Get<Parameters::LoadStep>(),
                       Parameters::Get<Parameters::SaveFile>(),
-                      Parameters::Get<Parameters::LoadFile>())
+                      Parameters::Get<Parameters::LoadFile>(),
+                      Parameters::Get<Parameters::SaveAsync>(),
+                      Parameters::Get<Parameters::SaveIncremental>())
     {
 
         // Only rank 0 does print to std::cout, and only if specifically requested.
@@ -549,10 +554,12 @@ public:
                 events.hasEvent(ScheduleEvents::PRODUCTION_UPDATE) ||
                 events.hasEvent(ScheduleEvents::INJECTION_UPDATE) ||
                 events.hasEvent(ScheduleEvents::WELL_STATUS_CHANGE);
+            const Parameters::TimestepLoopScope timestepLoopScope;
             auto stepReport = adaptiveTimeStepping_->step(timer, *solver_, event, tuningUpdater);
             report_ += stepReport;
         } else {
             // solve for complete report step
+            const Parameters::TimestepLoopScope timestepLoopScope;
             auto stepReport = solver_->step(timer, nullptr);
             report_ += stepReport;
             // Pass simulation report to eclwriter for summary output
@@ -615,6 +622,9 @@ public:
             report_.success.output_write_time += finalOutputTimer.stop();
         }
 
+        // make sure the last serialized state is written
+        serializer_.finish(report_.success);
+
         // Stop timer and create timing report
         totalTimer_->stop();
         report_.success.total_time = totalTimer_->secsSinceStart();
@@ -647,12 +657,12 @@ protected:
 #endif
     }
 
-    //! \brief Save simulator state using hdf5 serializer.
-    void saveState([[maybe_unused]] HDF5Serializer& serializer,
+    //! \brief Save simulator state to checkpoint snapshot.
+    void saveState([[maybe_unused]] CheckpointSnapshot& snapshot,
                    [[maybe_unused]] const std::string& groupName) const override
     {
 #if HAVE_HDF5
-        serializer.write(*this, groupName, "simulator_data");
+        snapshot.write(*this, groupName, "simulator_data");
 #endif
     }
 
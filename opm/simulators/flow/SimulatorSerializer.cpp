@@ -21,6 +21,7 @@
 #include <opm/simulators/flow/SimulatorSerializer.hpp>
 
 #include <dune/common/hash.hh>
+#include <dune/common/timer.hh>
 
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
@@ -28,16 +29,19 @@
 
 #include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
 
+#include <opm/simulators/timestepping/SimulatorReport.hpp>
 #include <opm/simulators/timestepping/SimulatorTimer.hpp>
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
 
 #if HAVE_HDF5
+#include <opm/simulators/utils/HDF5Checkpoint.hpp>
 #include <opm/simulators/utils/HDF5Serializer.hpp>
 #endif
 
 #include <algorithm>
 #include <filesystem>
 #include <stdexcept>
+#include <tuple>
 
 namespace Opm {
 
@@ -47,9 +51,13 @@ SimulatorSerializer::SimulatorSerializer([[maybe_unused]] SerializableSim& simul
                                          const std::string& saveSpec,
                                          int loadStep,
                                          const std::string& saveFile,
-                                         const std::string& loadFile)
+                                         const std::string& loadFile,
+                                         [[maybe_unused]] bool saveAsync,
+                                         [[maybe_unused]] bool saveIncremental)
 #if HAVE_HDF5
     : simulator_(simulator)
+    , saveAsync_(saveAsync)
+    , saveIncremental_(saveIncremental)
     , comm_(comm)
 #else
     : comm_(comm)
@@ -93,6 +101,8 @@ SimulatorSerializer::SimulatorSerializer([[maybe_unused]] SerializableSim& simul
     }
 }
 
+SimulatorSerializer::~SimulatorSerializer() = default;
+
 void SimulatorSerializer::save(SimulatorTimer& timer)
 {
     if (saveStride_ == 0 && saveStep_ == -1) {
@@ -105,31 +115,63 @@ void SimulatorSerializer::save(SimulatorTimer& timer)
     if ((saveStep_ != -1 && nextStep == saveStep_)  ||
         (saveStride_ != 0 && (nextStep % saveStride_) == 0)) {
 #if HAVE_HDF5
+        Dune::Timer saveTimer;
+        saveTimer.start();
+
         const std::string groupName = "/report_step/" + std::to_string(nextStep);
-        if (saveStride_ < 0 || nextStep == saveStride_ || nextStep == saveStep_) {
-            std::filesystem::remove(saveFile_);
-        }
-        HDF5Serializer writer(saveFile_, HDF5File::OpenMode::APPEND, comm_);
-        if (saveStride_ < 0 || nextStep == saveStride_ || nextStep == saveStep_) {
-            const auto data = simulator_.getHeader();
-            writer.writeHeader(data[0], data[1], data[2], data[3], data[4], comm_.size());
+        const bool newFile = saveStride_ < 0 || nextStep == saveStride_ || nextStep == saveStep_;
+        CheckpointSnapshot snapshot;
+        if (newFile) {
+            std::tuple<std::array<std::string,5>,int> header{simulator_.getHeader(), comm_.size()};
+            snapshot.write(header, "/", "simulator_info", HDF5File::DataSetMode::ROOT_ONLY);
 
             if (comm_.size() > 1) {
                 const auto& cellMapping = simulator_.getCellMapping();
                 std::size_t hash = Dune::hash_range(cellMapping.begin(), cellMapping.end());
-                writer.write(hash, "/", "grid_checksum");
+                snapshot.write(hash, "/", "grid_checksum");
             }
         }
-        simulator_.saveState(writer, groupName);
-        writer.write(timer, groupName, "simulator_timer",
-                     HDF5File::DataSetMode::ROOT_ONLY);
-        OpmLog::info("Serialized state written for report step " + std::to_string(nextStep));
+        simulator_.saveState(snapshot, groupName);
+        snapshot.write(timer, groupName, "simulator_timer",
+                       HDF5File::DataSetMode::ROOT_ONLY);
+
+        if (!writer_) {
+            writer_ = std::make_unique<CheckpointWriter>(saveFile_, comm_,
+                                                         saveAsync_, saveIncremental_);
+        }
+        writer_->write(std::move(snapshot), newFile);
+        saveTime_ += saveTimer.stop();
+
+        OpmLog::info("Serialized state " +
+                     std::string(writer_->isAsync() ? "queued" : "written") +
+                     " for report step " + std::to_string(nextStep));
 #endif
     }
 
     OPM_END_PARALLEL_TRY_CATCH("Error saving serialized state: ", comm_);
 }
 
+void SimulatorSerializer::finish([[maybe_unused]] SimulatorReportSingle& report)
+{
+#if HAVE_HDF5
+    if (!writer_) {
+        return;
+    }
+
+    Dune::Timer waitTimer;
+    waitTimer.start();
+
+    OPM_BEGIN_PARALLEL_TRY_CATCH();
+    writer_->wait();
+    OPM_END_PARALLEL_TRY_CATCH("Error saving serialized state: ", comm_);
+
+    saveTime_ += waitTimer.stop();
+    report.checkpoint_time += saveTime_;
+    report.checkpoint_write_time += writer_->writeTime();
+    report.checkpoint_bytes += writer_->bytesWritten();
+#endif
+}
+
     //! \brief Load timer info from serialized state.
 void SimulatorSerializer::loadTimerInfo([[maybe_unused]] SimulatorTimer& timer)
 {
@@ -206,7 +248,9 @@ void SimulatorSerializer::checkSerializedCmdLine(const std::string& current,
                                         line.compare(0, 8, "LoadFile") != 0 &&
                                         line.compare(0, 8, "SaveFile") != 0 &&
                                         line.compare(0, 8, "LoadStep") != 0 &&
-                                        line.compare(0, 8, "SaveStep") != 0;
+                                        line.compare(0, 8, "SaveStep") != 0 &&
+                                        line.compare(0, 9, "SaveAsync") != 0 &&
+                                        line.compare(0, 15, "SaveIncremental") != 0;
                              });
         return output;
     };
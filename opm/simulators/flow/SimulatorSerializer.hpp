@@ -23,14 +23,18 @@
 #include <opm/simulators/utils/ParallelCommunication.hpp>
 
 #include <array>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace Opm {
 
+class CheckpointSnapshot;
+class CheckpointWriter;
 class HDF5Serializer;
 class IOConfig;
 class SimulatorTimer;
+struct SimulatorReportSingle;
 
 //! \brief Abstract interface for simulator serialization ops.
 struct SerializableSim {
@@ -40,8 +44,8 @@ struct SerializableSim {
     virtual void loadState(HDF5Serializer& serializer,
                            const std::string& groupName) = 0;
 
-    //! \brief Save simulator state to file.
-    virtual void saveState(HDF5Serializer& serializer,
+    //! \brief Save simulator state to a checkpoint snapshot.
+    virtual void saveState(CheckpointSnapshot& snapshot,
                            const std::string& groupName) const = 0;
 
     //! \brief Get header info to save to file.
@@ -62,13 +66,20 @@ public:
     //! \param loadStep Step to load
     //! \param saveFile File to save to
     //! \param loadFile File to load from
+    //! \param saveAsync True to write on a background thread (serial runs only)
+    //! \param saveIncremental True to only write data changed since the last save
     SimulatorSerializer(SerializableSim& simulator,
                         Parallel::Communication& comm,
                         const IOConfig& ioconfig,
                         const std::string& saveSpec,
                         int loadStep,
                         const std::string& saveFile,
-                        const std::string& loadFile);
+                        const std::string& loadFile,
+                        bool saveAsync = false,
+                        bool saveIncremental = false);
+
+    //! \brief Destructor waits for a pending write.
+    ~SimulatorSerializer();
 
     //! \brief Returns whether or not a state should be loaded.
     bool shouldLoad() const { return loadStep_ > -1; }
@@ -77,8 +88,13 @@ public:
     int loadStep() const { return loadStep_; }
 
     //! \brief Save data to file if appropriate.
+    //! \details The state is copied to memory first, and written to file
+    //!          on a background thread if asynchronous saving is enabled.
     void save(SimulatorTimer& timer);
 
+    //! \brief Wait for pending writes and add checkpoint statistics to a report.
+    void finish(SimulatorReportSingle& report);
+
     //! \brief Loads time step info from file.
     void loadTimerInfo(SimulatorTimer& timer);
 
@@ -92,6 +108,10 @@ private:
 
 #if HAVE_HDF5
     SerializableSim& simulator_; //!< Reference to simulator to be use
+    std::unique_ptr<CheckpointWriter> writer_; //!< Writer for saved states
+    bool saveAsync_ = false; //!< True to write saved states on a background thread
+    bool saveIncremental_ = false; //!< True to only write changed data
+    double saveTime_ = 0.0; //!< Time the simulation was blocked by saving
 #endif // HAVE_HDF5
     Parallel::Communication& comm_; //!< Communication to use
     int saveStride_ = 0; //!< Stride to save serialized state at, negative to only keep last
@@ -36,8 +36,10 @@
 #include <opm/grid/utility/ElementChunks.hpp>
 
 #include <opm/models/parallel/threadmanager.hpp>
+#include <opm/models/utils/parametersystem.hpp>
 #include <opm/models/utils/propertysystem.hh>
 
+#include <opm/simulators/flow/FlowProblemParameters.hpp>
 #include <opm/simulators/flow/GenericTracerModel.hpp>
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
 #include <opm/simulators/utils/VectorVectorDataHandle.hpp>
@@ -114,7 +116,9 @@ public:
         , oil_(tbatch[1])
         , gas_(tbatch[2])
         , element_chunks_(simulator.gridView(), Dune::Partitions::all, ThreadManager::maxThreads())
-    { }
+    {
+        this->fluxOrderedSolver_ = Parameters::Get<Parameters::EnableFluxOrderedTracerSolver>();
+    }
 
 
     /*
@@ -773,9 +773,9 @@ private:
                                PhaseSat&               psat);
 
      template<class CellRange, class PressTable, class PhaseSat>
-     void equilibrateTiltedFaultBlock(const CellRange& cells, 
+     void equilibrateTiltedFaultBlock(const CellRange& cells,
                             const EquilReg<Scalar>& eqreg,
-                            const GridView& gridView, const int numLevels,
+                            const std::vector<Element>& entityMap, const int numLevels,
                             const PressTable& ptable, PhaseSat& psat);
 
      template<class CellRange, class PressTable, class PhaseSat>
@@ -56,8 +56,12 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <exception>
+#include <iterator>
 #include <limits>
+#include <mutex>
 #include <numbers>
+#include <optional>
 #include <stdexcept>
 
 namespace Opm {
@@ -2007,68 +2011,151 @@ calcPressSatRsRv(const RMap& reg,
     using PhaseSat = Details::PhaseSaturations<
         MaterialLawManager, FluidSystem, EquilReg<Scalar>, typename RMap::CellId
     >;
+    using PTable = Details::PressureTable<FluidSystem, EquilReg<Scalar>>;
+    using CellIter = decltype(reg.cells(0).begin());
+
+    const std::size_t numRegions = rec.size();
+
+    // Vertical extent of all regions, reduced with one collective per bound
+    // rather than two per region.
+    std::vector<Scalar> spanMin(numRegions, std::numeric_limits<Scalar>::max());
+    std::vector<Scalar> spanMax(numRegions, std::numeric_limits<Scalar>::lowest());
+    for (std::size_t r = 0; r < numRegions; ++r) {
+        for (const auto& cell : reg.cells(r)) {
+            spanMin[r] = std::min(spanMin[r], cellZMinMax_[cell].first);
+            spanMax[r] = std::max(spanMax[r], cellZMinMax_[cell].second);
+        }
+    }
+    comm.min(spanMin.data(), spanMin.size());
+    comm.max(spanMax.data(), spanMax.size());
+
+    // Every region with cells on this process gets its own pressure table,
+    // such that the regions can be equilibrated independently.
+    std::vector<int> regionIsEmpty(numRegions, 0);
+    std::vector<std::size_t> activeRegions;
+    std::vector<std::optional<EquilReg<Scalar>>> eqregs(numRegions);
+    std::vector<std::optional<PTable>> ptables(numRegions);
+    for (std::size_t r = 0; r < numRegions; ++r) {
+        if (reg.cells(r).empty()) {
+            regionIsEmpty[r] = 1;
+            continue;
+        }
+        eqregs[r].emplace(rec[r], this->rsFunc_[r], this->rvFunc_[r], this->rvwFunc_[r],
+                          this->tempVdTable_[r], this->saltVdTable_[r], this->regionPvtIdx_[r]);
+        ptables[r].emplace(grav, this->num_pressure_points_);
+        activeRegions.push_back(r);
+    }
 
-    auto ptable = Details::PressureTable<FluidSystem, EquilReg<Scalar>>{ grav, this->num_pressure_points_ };
-    auto psat   = PhaseSat { materialLawManager, this->swatInit_ };
-    auto vspan  = std::array<Scalar, 2>{};
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+    const auto storeException = [&exception, &exceptionMutex]()
+    {
+        std::lock_guard<std::mutex> lock(exceptionMutex);
+        if (!exception) {
+            exception = std::current_exception();
+        }
+    };
 
-    std::vector<int> regionIsEmpty(rec.size(), 0);
-    for (std::size_t r = 0; r < rec.size(); ++r) {
-        const auto& cells = reg.cells(r);
+    const int numActiveRegions = activeRegions.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (int i = 0; i < numActiveRegions; ++i) {
+        const auto r = activeRegions[i];
+        try {
+            const auto& eqreg = *eqregs[r];
+            // Ensure contacts are within the span
+            const auto vspan = std::array<Scalar, 2> {
+                std::min(spanMin[r], std::min(eqreg.zgoc(), eqreg.zwoc())),
+                std::max(spanMax[r], std::max(eqreg.zgoc(), eqreg.zwoc()))
+            };
+            ptables[r]->equilibrate(eqreg, vspan);
+        }
+        catch (...) {
+            storeException();
+        }
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
 
-        Details::verticalExtent(cells, cellZMinMax_, comm, vspan);
+    // Split the cells of each region into chunks, which keeps all threads
+    // busy both for many small regions and for few large ones.
+    struct CellChunk {
+        std::size_t region;
+        CellIter first;
+        CellIter last;
 
-        const auto acc = rec[r].initializationTargetAccuracy();
-        if (acc > 0) {
-            // The grid blocks are treated as being tilted
-            // First check if the region has cells
-            if (cells.empty()) {
-                regionIsEmpty[r] = 1;
-                continue;
-            }
-            const auto eqreg = EquilReg {
-                rec[r], this->rsFunc_[r], this->rvFunc_[r], this->rvwFunc_[r],
-                this->tempVdTable_[r], this->saltVdTable_[r], this->regionPvtIdx_[r]
-            };
-            // Ensure contacts are within the span
-            vspan[0] = std::min(vspan[0], std::min(eqreg.zgoc(), eqreg.zwoc()));
-            vspan[1] = std::max(vspan[1], std::max(eqreg.zgoc(), eqreg.zwoc()));
-            ptable.equilibrate(eqreg, vspan);
-            // For titled blocks, we can use a simple weightening based on title of the grid
-            // this->equilibrateTiltedFaultBlockSimple(cells, eqreg, gridView, acc, ptable, psat);
-            this->equilibrateTiltedFaultBlock(cells, eqreg, gridView, acc, ptable, psat);
+        CellIter begin() const { return first; }
+        CellIter end() const { return last; }
+    };
+    constexpr std::ptrdiff_t cellChunkSize = 512;
+    std::vector<CellChunk> chunks;
+    for (const auto r : activeRegions) {
+        const auto& cells = reg.cells(r);
+        for (auto first = cells.begin(); first != cells.end();) {
+            const auto remaining = std::distance(first, cells.end());
+            const auto last = std::next(first, std::min<std::ptrdiff_t>(cellChunkSize, remaining));
+            chunks.push_back({r, first, last});
+            first = last;
         }
-        else if (acc == 0) {
-            if (cells.empty()) {
-                regionIsEmpty[r] = 1;
-                continue;
-            }
-            const auto eqreg = EquilReg {
-                rec[r], this->rsFunc_[r], this->rvFunc_[r], this->rvwFunc_[r],
-                this->tempVdTable_[r], this->saltVdTable_[r], this->regionPvtIdx_[r]
-            };
-            vspan[0] = std::min(vspan[0], std::min(eqreg.zgoc(), eqreg.zwoc()));
-            vspan[1] = std::max(vspan[1], std::max(eqreg.zgoc(), eqreg.zwoc()));
-            ptable.equilibrate(eqreg, vspan);
-            // Centre-point method
-            this->equilibrateCellCentres(cells, eqreg, ptable, psat);
+    }
+
+    // The tilted block method needs the elements by their index.
+    std::vector<Element> elements;
+    if (std::ranges::any_of(activeRegions, [&rec](const std::size_t r)
+                            { return rec[r].initializationTargetAccuracy() > 0; }))
+    {
+        elements.resize(gridView.size(0));
+        for (const auto& elem : entities(gridView, Dune::Codim<0>())) {
+            elements[gridView.indexSet().index(elem)] = elem;
         }
-        else if (acc < 0) {
-            if (cells.empty()) {
-                regionIsEmpty[r] = 1;
-                continue;
+    }
+
+    const int numChunks = chunks.size();
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        // The saturations are derived through the state of the last
+        // evaluation point, so each thread needs its own object.  The
+        // material law manager is only modified for the cell being
+        // equilibrated.
+        auto psat = PhaseSat { materialLawManager, this->swatInit_ };
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for (int c = 0; c < numChunks; ++c) {
+            const auto& chunk = chunks[c];
+            const auto& eqreg = *eqregs[chunk.region];
+            const auto& ptable = *ptables[chunk.region];
+            try {
+                const auto acc = rec[chunk.region].initializationTargetAccuracy();
+                if (acc > 0) {
+                    // The grid blocks are treated as being tilted
+                    // For titled blocks, we can use a simple weightening based on title of the grid
+                    // this->equilibrateTiltedFaultBlockSimple(chunk, eqreg, gridView, acc, ptable, psat);
+                    this->equilibrateTiltedFaultBlock(chunk, eqreg, elements, acc, ptable, psat);
+                }
+                else if (acc == 0) {
+                    // Centre-point method
+                    this->equilibrateCellCentres(chunk, eqreg, ptable, psat);
+                }
+                else {
+                    // Horizontal subdivision
+                    this->equilibrateHorizontal(chunk, eqreg, -acc, ptable, psat);
+                }
+            }
+            catch (...) {
+                storeException();
             }
-            const auto eqreg = EquilReg {
-                rec[r], this->rsFunc_[r], this->rvFunc_[r], this->rvwFunc_[r],
-                this->tempVdTable_[r], this->saltVdTable_[r], this->regionPvtIdx_[r]
-            };
-            vspan[0] = std::min(vspan[0], std::min(eqreg.zgoc(), eqreg.zwoc()));
-            vspan[1] = std::max(vspan[1], std::max(eqreg.zgoc(), eqreg.zwoc()));
-            ptable.equilibrate(eqreg, vspan);
-            // Horizontal subdivision
-            this->equilibrateHorizontal(cells, eqreg, -acc, ptable, psat);
         }
     }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+
     comm.min(regionIsEmpty.data(),regionIsEmpty.size());
     if (comm.rank() == 0) {
         for (std::size_t r = 0; r < rec.size(); ++r) {
@@ -2367,23 +2454,17 @@ equilibrateTiltedFaultBlockSimple(const CellRange& cells,
 template<class FluidSystem, class Grid, class GridView, class ElementMapper, class CartesianIndexMapper>
 template<class CellRange, class PressTable, class PhaseSat>
 void InitialStateComputer<FluidSystem, Grid, GridView, ElementMapper, CartesianIndexMapper>::
-equilibrateTiltedFaultBlock(const CellRange&        cells,
-                             const EquilReg<Scalar>& eqreg,
-                             const GridView&         gridView,
-                             const int               acc,
-                             const PressTable&       ptable,
-                             PhaseSat&               psat)
+equilibrateTiltedFaultBlock(const CellRange&            cells,
+                             const EquilReg<Scalar>&     eqreg,
+                             const std::vector<Element>& entityMap,
+                             const int                   acc,
+                             const PressTable&           ptable,
+                             PhaseSat&                   psat)
 {
     using CellPos = typename PhaseSat::Position;
     using CellID  = std::remove_cv_t<std::remove_reference_t<
         decltype(std::declval<CellPos>().cell)>>;
 
-    std::vector<typename GridView::template Codim<0>::Entity> entityMap(gridView.size(0));
-    for (const auto& entity : entities(gridView, Dune::Codim<0>())) {
-        CellID idx = gridView.indexSet().index(entity);
-        entityMap[idx] = entity;
-    }
-
     // Face Area Calculation
     auto polygonArea = [](const std::vector<std::array<Scalar, 2>>& pts) {
         if (pts.size() < 3) return Scalar(0);
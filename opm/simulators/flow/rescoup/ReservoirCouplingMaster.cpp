@@ -355,19 +355,19 @@ rebuildSlaveIdxToMasterGroupsVector()
 template <class Scalar>
 void
 ReservoirCouplingMaster<Scalar>::
-receiveInjectionDataFromSlaves()
+postReceiveDataFromSlaves()
 {
     assert(this->report_step_data_);
-    this->report_step_data_->receiveInjectionDataFromSlaves();
+    this->report_step_data_->postReceiveDataFromSlaves();
 }
 
 template <class Scalar>
 void
 ReservoirCouplingMaster<Scalar>::
-receiveProductionDataFromSlaves()
+receiveDataFromSlaves()
 {
     assert(this->report_step_data_);
-    this->report_step_data_->receiveProductionDataFromSlaves();
+    this->report_step_data_->receiveDataFromSlaves();
 }
 
 template <class Scalar>
@@ -126,10 +126,14 @@ public:
     std::size_t numSlaves() const { return this->numSlavesStarted(); }
     std::size_t numSlavesStarted() const;
     std::size_t numActivatedSlaves() const;
+    /// @brief Start receiving production and injection data from the slaves.
+    /// @details The receives are non-blocking, and completed by receiveDataFromSlaves().
+    ///          This lets the master compute its own substep while the slaves
+    ///          compute theirs.
+    void postReceiveDataFromSlaves();
     void rebuildSlaveIdxToMasterGroupsVector();
+    void receiveDataFromSlaves();
     void receiveNextReportDateFromSlaves();
-    void receiveProductionDataFromSlaves();
-    void receiveInjectionDataFromSlaves();
     void resizeNextReportDates(int size);
     void resizeSlaveActivationDates(int size) { this->slave_activation_dates_.resize(size); }
     void resizeSlaveStartDates(int size) { this->slave_start_dates_.resize(size); }
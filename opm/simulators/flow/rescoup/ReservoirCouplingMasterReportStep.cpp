@@ -23,6 +23,7 @@
 #include <opm/simulators/flow/rescoup/ReservoirCouplingMpiTraits.hpp>
 #include <opm/simulators/flow/rescoup/ReservoirCouplingMaster.hpp>
 #include <opm/simulators/flow/rescoup/ReservoirCouplingMasterReportStep.hpp>
+#include <opm/simulators/flow/rescoup/ReservoirCouplingRequests.hpp>
 
 #include <opm/input/eclipse/Schedule/ResCoup/ReservoirCouplingInfo.hpp>
 #include <opm/input/eclipse/Schedule/ResCoup/MasterGroup.hpp>
@@ -124,106 +125,117 @@ getSlaveGroupPotentials(const std::string &master_group_name) const
 template <class Scalar>
 void
 ReservoirCouplingMasterReportStep<Scalar>::
-receiveInjectionDataFromSlaves()
+postReceiveDataFromSlaves()
 {
+    if (this->receives_posted_) {
+        return;
+    }
+    this->receives_posted_ = true;
+    // Only rank 0 receives data from slaves, the other ranks of the master
+    // get the data by the broadcast in receiveDataFromSlaves().
+    if (this->comm().rank() != 0) {
+        return;
+    }
     auto num_slaves = this->numSlaves();
-    this->logger().debug("Receiving injection data from slave processes");
+    this->received_production_data_.resize(num_slaves);
+    this->received_injection_data_.resize(num_slaves);
     for (unsigned int i = 0; i < num_slaves; i++) {
         auto num_slave_groups = this->numSlaveGroups(i);
-        if (num_slave_groups == 0) {
-            // History mode: no slave groups defined, skip data exchange
-            this->logger().debug(fmt::format(
-                "Slave {} has no slave groups (history mode), skipping injection data exchange",
-                this->slaveName(i)
-            ));
+        // History mode (no slave groups) and slaves that have not activated
+        // yet do not send any data.
+        if (num_slave_groups == 0 || !this->slaveIsActivated(i)) {
             continue;
         }
-        std::vector<SlaveGroupInjectionData> injection_data(num_slave_groups);
-        if (this->comm().rank() == 0) {
-            if (this->slaveIsActivated(i)) {
-                // NOTE: See comment about error handling at the top of this file.
-                auto MPI_INJECTION_DATA_TYPE = Dune::MPITraits<SlaveGroupInjectionData>::getType();
-                MPI_Recv(
-                    injection_data.data(),
-                    /*count=*/num_slave_groups,
-                    /*datatype=*/MPI_INJECTION_DATA_TYPE,
-                    /*source_rank=*/0,
-                    /*tag=*/static_cast<int>(MessageTag::SlaveInjectionData),
-                    this->getSlaveComm(i),
-                    MPI_STATUS_IGNORE
-                );
-                this->logger().debug(fmt::format(
-                    "Received injection data for {} groups from {}",
-                    num_slave_groups, this->slaveName(i)
-                ));
-            }
-            else {
-                this->logger().debug(fmt::format(
-                    "Slave {} has not activated yet, skipping injection data",
-                    this->slaveName(i)
-                ));
-                injection_data.assign(num_slave_groups, SlaveGroupInjectionData{}); // Set to zero injection data
-            }
-        }
-        // NOTE: The dune broadcast() below will do something like:
-        //    MPI_Bcast(inout,len,MPITraits<SlaveGroupInjectionData>::getType(),root,communicator)
-        //  so it should use the custom SlaveGroupInjectionData MPI type that we defined in
-        //  ReservoirCouplingMpiTraits.hpp
-        this->comm().broadcast(injection_data.data(), /*count=*/num_slave_groups, /*emitter_rank=*/0);
-        this->slave_group_injection_data_[this->slaveName(i)] = injection_data;
+        this->received_production_data_[i].resize(num_slave_groups);
+        this->received_injection_data_[i].resize(num_slave_groups);
+        // NOTE: See comment about error handling at the top of this file.
+        this->receives_.postReceive(
+            this->received_production_data_[i], /*source_rank=*/0,
+            MessageTag::SlaveProductionData, this->getSlaveComm(i), /*id=*/2 * i
+        );
+        this->receives_.postReceive(
+            this->received_injection_data_[i], /*source_rank=*/0,
+            MessageTag::SlaveInjectionData, this->getSlaveComm(i), /*id=*/2 * i + 1
+        );
     }
 }
 
 template <class Scalar>
 void
 ReservoirCouplingMasterReportStep<Scalar>::
-receiveProductionDataFromSlaves()
+receiveDataFromSlaves()
 {
     auto num_slaves = this->numSlaves();
-    this->logger().debug("Receiving production data from slave processes");
+    this->logger().debug("Receiving production and injection data from slave processes");
+    this->postReceiveDataFromSlaves();
+    if (this->comm().rank() == 0) {
+        this->sends_.waitAll();
+        // Handle the data in the order it arrives, not in the order of the slaves.
+        while (const auto id = this->receives_.waitAny()) {
+            const auto slave_idx = *id / 2;
+            const bool is_production = (*id % 2 == 0);
+            this->logger().debug(fmt::format(
+                "Received {} data for {} groups from {}",
+                is_production ? "production" : "injection",
+                this->numSlaveGroups(slave_idx), this->slaveName(slave_idx)
+            ));
+        }
+    }
+    this->receives_posted_ = false;
+
+    // Distribute the data of all slaves to the other ranks of the master with
+    // one broadcast per kind of data, rather than one per slave.
+    std::vector<SlaveGroupProductionData> production_data;
+    std::vector<SlaveGroupInjectionData> injection_data;
     for (unsigned int i = 0; i < num_slaves; i++) {
         auto num_slave_groups = this->numSlaveGroups(i);
         if (num_slave_groups == 0) {
             // History mode: no slave groups defined, skip data exchange
             this->logger().debug(fmt::format(
-                "Slave {} has no slave groups (history mode), skipping production data exchange",
+                "Slave {} has no slave groups (history mode), skipping data exchange",
                 this->slaveName(i)
             ));
             continue;
         }
-        std::vector<SlaveGroupProductionData> production_data(num_slave_groups);
-        if (this->comm().rank() == 0) {
-            if (this->slaveIsActivated(i)) {
-                // NOTE: See comment about error handling at the top of this file.
-                auto MPI_PRODUCTION_DATA_TYPE = Dune::MPITraits<SlaveGroupProductionData>::getType();
-                MPI_Recv(
-                    production_data.data(),
-                    /*count=*/num_slave_groups,
-                    /*datatype=*/MPI_PRODUCTION_DATA_TYPE,
-                    /*source_rank=*/0,
-                    /*tag=*/static_cast<int>(MessageTag::SlaveProductionData),
-                    this->getSlaveComm(i),
-                    MPI_STATUS_IGNORE
-                );
-                this->logger().debug(fmt::format(
-                    "Received production data for {} groups from {}",
-                    num_slave_groups, this->slaveName(i)
-                ));
-            }
-            else {
+        if (this->comm().rank() == 0 && this->slaveIsActivated(i)) {
+            const auto& production = this->received_production_data_[i];
+            const auto& injection = this->received_injection_data_[i];
+            production_data.insert(production_data.end(), production.begin(), production.end());
+            injection_data.insert(injection_data.end(), injection.begin(), injection.end());
+        }
+        else {
+            if (this->comm().rank() == 0) {
                 this->logger().debug(fmt::format(
-                    "Slave {} has not activated yet, skipping production data",
+                    "Slave {} has not activated yet, skipping production and injection data",
                     this->slaveName(i)
                 ));
-                production_data.assign(num_slave_groups, SlaveGroupProductionData{}); // Set to zero production data
             }
+            // Set to zero production and injection data
+            production_data.resize(production_data.size() + num_slave_groups);
+            injection_data.resize(injection_data.size() + num_slave_groups);
         }
-        // NOTE: The dune broadcast() below will do something like:
-        //    MPI_Bcast(inout,len,MPITraits<SlaveGroupProductionData>::getType(),root,communicator)
-        //  so it should use the custom SlaveGroupProductionData MPI type that we defined in
-        //  ReservoirCouplingMpiTraits.hpp
-        this->comm().broadcast(production_data.data(), /*count=*/num_slave_groups, /*emitter_rank=*/0);
-        this->slave_group_production_data_[this->slaveName(i)] = production_data;
+    }
+    // NOTE: The dune broadcast() below will do something like:
+    //    MPI_Bcast(inout,len,MPITraits<SlaveGroupProductionData>::getType(),root,communicator)
+    //  so it should use the custom SlaveGroupProductionData MPI type that we defined in
+    //  ReservoirCouplingMpiTraits.hpp
+    this->comm().broadcast(production_data.data(), /*count=*/production_data.size(), /*emitter_rank=*/0);
+    this->comm().broadcast(injection_data.data(), /*count=*/injection_data.size(), /*emitter_rank=*/0);
+
+    std::size_t offset = 0;
+    for (unsigned int i = 0; i < num_slaves; i++) {
+        auto num_slave_groups = this->numSlaveGroups(i);
+        if (num_slave_groups == 0) {
+            continue;
+        }
+        const auto& name = this->slaveName(i);
+        this->slave_group_production_data_[name].assign(
+            production_data.begin() + offset, production_data.begin() + offset + num_slave_groups
+        );
+        this->slave_group_injection_data_[name].assign(
+            injection_data.begin() + offset, injection_data.begin() + offset + num_slave_groups
+        );
+        offset += num_slave_groups;
     }
 }
 
@@ -231,20 +243,17 @@ template <class Scalar>
 void
 ReservoirCouplingMasterReportStep<Scalar>::
 sendInjectionTargetsToSlave(std::size_t slave_idx,
-                            const std::vector<InjectionGroupTarget>& injection_targets) const
+                            const std::vector<InjectionGroupTarget>& injection_targets)
 {
     // Only rank 0 sends data to slaves. Other ranks in the master's MPI communicator
     // do not participate in master-slave communication (no else branch needed).
     if (this->comm().rank() == 0) {
         auto num_injection_targets = injection_targets.size();
-        auto MPI_INJECTION_TARGETS_TYPE = Dune::MPITraits<InjectionGroupTarget>::getType();
         // NOTE: See comment about error handling at the top of this file.
-        MPI_Send(
-            injection_targets.data(),
-            /*count=*/num_injection_targets,
-            /*datatype=*/MPI_INJECTION_TARGETS_TYPE,
+        this->sends_.postSend(
+            injection_targets,
             /*dest_rank=*/0,
-            /*tag=*/static_cast<int>(MessageTag::InjectionGroupTargets),
+            MessageTag::InjectionGroupTargets,
             this->getSlaveComm(slave_idx)
         );
         this->logger().debug(fmt::format(
@@ -260,7 +269,7 @@ void
 ReservoirCouplingMasterReportStep<Scalar>::
 sendNumGroupConstraintsToSlave(std::size_t slave_idx,
                            std::size_t num_injection_targets,
-                           std::size_t num_production_constraints) const
+                           std::size_t num_production_constraints)
 {
     // Only rank 0 sends data to slaves. Other ranks in the master's MPI communicator
     // do not participate in master-slave communication (no else branch needed).
@@ -268,14 +277,11 @@ sendNumGroupConstraintsToSlave(std::size_t slave_idx,
         std::vector<std::size_t> num_targets(2);
         num_targets[0] = num_injection_targets;
         num_targets[1] = num_production_constraints;
-        auto MPI_SIZE_T_TYPE = Dune::MPITraits<std::size_t>::getType();
         // NOTE: See comment about error handling at the top of this file.
-        MPI_Send(
-            num_targets.data(),
-            /*count=*/2,
-            /*datatype=*/MPI_SIZE_T_TYPE,
+        this->sends_.postSend(
+            std::move(num_targets),
             /*dest_rank=*/0,
-            /*tag=*/static_cast<int>(MessageTag::NumSlaveGroupConstraints),
+            MessageTag::NumSlaveGroupConstraints,
             this->getSlaveComm(slave_idx)
         );
         this->logger().debug(fmt::format(
@@ -289,20 +295,17 @@ template <class Scalar>
 void
 ReservoirCouplingMasterReportStep<Scalar>::
 sendProductionConstraintsToSlave(std::size_t slave_idx,
-                             const std::vector<ProductionGroupConstraints>& production_constraints) const
+                             const std::vector<ProductionGroupConstraints>& production_constraints)
 {
     // Only rank 0 sends data to slaves. Other ranks in the master's MPI communicator
     // do not participate in master-slave communication (no else branch needed).
     if (this->comm().rank() == 0) {
         auto num_production_constraints = production_constraints.size();
-        auto MPI_PRODUCTION_CONSTRAINTS_TYPE = Dune::MPITraits<ProductionGroupConstraints>::getType();
         // NOTE: See comment about error handling at the top of this file.
-        MPI_Send(
-            production_constraints.data(),
-            /*count=*/num_production_constraints,
-            /*datatype=*/MPI_PRODUCTION_CONSTRAINTS_TYPE,
+        this->sends_.postSend(
+            production_constraints,
             /*dest_rank=*/0,
-            /*tag=*/static_cast<int>(MessageTag::ProductionGroupConstraints),
+            MessageTag::ProductionGroupConstraints,
             this->getSlaveComm(slave_idx)
         );
         this->logger().debug(fmt::format(
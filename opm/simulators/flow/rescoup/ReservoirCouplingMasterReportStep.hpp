@@ -22,6 +22,7 @@
 
 #include <opm/simulators/flow/rescoup/ReservoirCoupling.hpp>
 #include <opm/simulators/flow/rescoup/ReservoirCouplingMpiTraits.hpp>
+#include <opm/simulators/flow/rescoup/ReservoirCouplingRequests.hpp>
 #include <opm/output/data/Groups.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/simulators/utils/ParallelCommunication.hpp>
@@ -176,40 +177,51 @@ public:
     /// @return Reference to the logger object for this coupling session
     ReservoirCoupling::Logger& logger() const { return this->master_.logger(); }
 
-    /// @brief Receive injection data from all active slave processes
+    /// @brief Start receiving production and injection data from all active slave processes
     ///
-    /// This method receives injection rates and related data from each slave process
-    /// via MPI communication. The data is organized by slave groups
-    /// and stored in slave_group_injection_data_ for use in group control calculations.
+    /// Posts non-blocking receives for the next production and injection data of
+    /// every activated slave, such that the master can continue with its own
+    /// computations while the slaves compute. The receives are completed by
+    /// receiveDataFromSlaves(). Does nothing if receives are already pending.
     ///
-    /// @note This is a blocking operation that waits for all slaves to send data
-    /// @note Must be called after slaves have computed and sent their injection data
-    void receiveInjectionDataFromSlaves();
+    /// @note Must not be called while the previous data of the slaves has not
+    ///       been received, since the receives would match that data instead.
+    void postReceiveDataFromSlaves();
 
-    /// @brief Receive production data from all active slave processes
+    /// @brief Receive production and injection data from all active slave processes
+    ///
+    /// This method receives production rates, potentials, injection rates and
+    /// related data from each slave process via MPI communication, posting the
+    /// receives first if postReceiveDataFromSlaves() has not been called. The
+    /// data of each slave is handled as soon as it arrives, independent of the
+    /// order of the slaves. The data is organized by slave groups and stored in
+    /// slave_group_production_data_ and slave_group_injection_data_ for use in
+    /// group control calculations.
     ///
-    /// This method receives production rates, potentials, and related data from each
-    /// slave process via MPI communication. The data is organized by
-    /// slave groups and stored in slave_group_production_data_ for use in group
-    /// control calculations.
+    /// Sends to the slaves that are still pending are completed first.
     ///
     /// @note This is a blocking operation that waits for all slaves to send data
-    /// @note Must be called after slaves have computed and sent their production data
-    void receiveProductionDataFromSlaves();
+    /// @note Must be called after slaves have computed and sent their data
+    void receiveDataFromSlaves();
 
     /// @brief Get the simulation schedule
     /// @return Reference to the Schedule object containing well and group definitions
     const Schedule &schedule() const { return this->master_.schedule(); }
 
+    /// @brief Send constraints to a slave process
+    ///
+    /// The sends are non-blocking, so the master does not wait for one slave
+    /// to receive before sending to the next one. They are completed by
+    /// receiveDataFromSlaves().
     void sendInjectionTargetsToSlave(
         std::size_t slave_idx, const std::vector<InjectionGroupTarget>& injection_targets
-    ) const;
+    );
     void sendNumGroupConstraintsToSlave(
         std::size_t slave_idx, std::size_t num_injection_targets, std::size_t num_production_constraints
-    ) const;
+    );
     void sendProductionConstraintsToSlave(
         std::size_t slave_idx, const std::vector<ProductionGroupConstraints>& production_constraints
-    ) const;
+    );
 
     /// @brief Set whether this is the first substep within a "sync" timestep.
     /// @param value true at start of sync timestep, false after first runSubStep_() call
@@ -257,6 +269,22 @@ private:
     /// Injection data for each slave group (map key: master group name)
     std::map<std::string, std::vector<SlaveGroupInjectionData>> slave_group_injection_data_;
 
+    /// Receive buffers for the production data of each slave (index: slave index).
+    /// Separate from slave_group_production_data_, which stays valid while receiving.
+    std::vector<std::vector<SlaveGroupProductionData>> received_production_data_;
+
+    /// Receive buffers for the injection data of each slave (index: slave index)
+    std::vector<std::vector<SlaveGroupInjectionData>> received_injection_data_;
+
+    /// Pending receives of slave data (only used on rank 0)
+    ReservoirCoupling::PendingRequests receives_;
+
+    /// Pending sends of constraints to slaves (only used on rank 0)
+    ReservoirCoupling::PendingRequests sends_;
+
+    /// Flag to indicate that the receives of slave data have been posted
+    bool receives_posted_{false};
+
     /// Flag to track if this is the first substep within a "sync" timestep.
     /// Used to control reservoir coupling synchronization.
     bool is_first_substep_of_sync_timestep_{true};
@@ -0,0 +1,164 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_RESERVOIR_COUPLING_REQUESTS_HPP
+#define OPM_RESERVOIR_COUPLING_REQUESTS_HPP
+
+#include <opm/simulators/flow/rescoup/ReservoirCoupling.hpp>
+
+#include <dune/common/parallel/mpitraits.hh>
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+namespace ReservoirCoupling {
+
+/// @brief A set of pending non-blocking point-to-point operations
+///
+/// Used by the master process to exchange data with several slaves at once.
+/// Receives are completed in the order the messages arrive, rather than in
+/// the order of the slaves, so data from a fast slave is handled while a
+/// slower slave is still computing. Sends keep a copy of their data until
+/// they complete, so the caller can continue right away.
+///
+/// The MPI datatype of the elements is given by Dune::MPITraits, see
+/// ReservoirCouplingMpiTraits.hpp for the types exchanged between master and
+/// slaves.
+///
+/// @note All pending operations must be completed with waitAny() or waitAll()
+///       before the set is destroyed.
+class PendingRequests {
+public:
+    /// @brief Post a non-blocking receive
+    /// @param buffer Buffer to receive into, sized to the expected number of
+    ///        elements. It must stay alive and unchanged until the receive is
+    ///        completed.
+    /// @param source_rank Rank of the sender in @p comm
+    /// @param tag Tag of the message
+    /// @param comm Communicator to receive on
+    /// @param id Identifier returned by waitAny() when the receive completes
+    template <class T>
+    void postReceive(std::vector<T>& buffer, int source_rank, MessageTag tag,
+                     MPI_Comm comm, std::size_t id)
+    {
+        MPI_Request request;
+        MPI_Irecv(
+            buffer.data(),
+            /*count=*/static_cast<int>(buffer.size()),
+            /*datatype=*/Dune::MPITraits<T>::getType(),
+            source_rank,
+            /*tag=*/static_cast<int>(tag),
+            comm,
+            &request
+        );
+        this->requests_.push_back(request);
+        this->ids_.push_back(id);
+        this->buffers_.emplace_back();
+        ++this->num_pending_;
+    }
+
+    /// @brief Post a non-blocking send
+    /// @param data Data to send, kept by the set until the send is completed
+    /// @param dest_rank Rank of the receiver in @p comm
+    /// @param tag Tag of the message
+    /// @param comm Communicator to send on
+    template <class T>
+    void postSend(std::vector<T> data, int dest_rank, MessageTag tag, MPI_Comm comm)
+    {
+        auto buffer = std::make_shared<std::vector<T>>(std::move(data));
+        MPI_Request request;
+        MPI_Isend(
+            buffer->data(),
+            /*count=*/static_cast<int>(buffer->size()),
+            /*datatype=*/Dune::MPITraits<T>::getType(),
+            dest_rank,
+            /*tag=*/static_cast<int>(tag),
+            comm,
+            &request
+        );
+        this->requests_.push_back(request);
+        this->ids_.push_back(0);
+        this->buffers_.push_back(std::move(buffer));
+        ++this->num_pending_;
+    }
+
+    /// @brief Wait until any pending operation completes
+    /// @return Identifier of the completed operation, or std::nullopt if
+    ///         there are no pending operations left. The set is empty
+    ///         afterwards in the latter case.
+    std::optional<std::size_t> waitAny()
+    {
+        if (this->num_pending_ == 0) {
+            this->clear_();
+            return std::nullopt;
+        }
+        int index = MPI_UNDEFINED;
+        MPI_Waitany(static_cast<int>(this->requests_.size()), this->requests_.data(),
+                    &index, MPI_STATUS_IGNORE);
+        if (index == MPI_UNDEFINED) {
+            this->clear_();
+            return std::nullopt;
+        }
+        --this->num_pending_;
+        this->buffers_[index].reset();
+        return this->ids_[index];
+    }
+
+    /// @brief Wait until all pending operations complete
+    void waitAll()
+    {
+        if (!this->requests_.empty()) {
+            MPI_Waitall(static_cast<int>(this->requests_.size()), this->requests_.data(),
+                        MPI_STATUSES_IGNORE);
+        }
+        this->clear_();
+    }
+
+    /// @brief Check whether there are pending operations
+    bool empty() const { return this->num_pending_ == 0; }
+
+private:
+    void clear_()
+    {
+        this->requests_.clear();
+        this->ids_.clear();
+        this->buffers_.clear();
+        this->num_pending_ = 0;
+    }
+
+    /// MPI requests, completed requests are set to MPI_REQUEST_NULL by MPI
+    std::vector<MPI_Request> requests_;
+    /// Identifier of each request, returned by waitAny()
+    std::vector<std::size_t> ids_;
+    /// Copy of the data of each pending send, empty for receives
+    std::vector<std::shared_ptr<void>> buffers_;
+    /// Number of requests which have not completed
+    std::size_t num_pending_{0};
+};
+
+} // namespace ReservoirCoupling
+} // namespace Opm
+
+#endif // OPM_RESERVOIR_COUPLING_REQUESTS_HPP
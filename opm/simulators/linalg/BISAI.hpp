@@ -0,0 +1,281 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_BISAI_HEADER_INCLUDED
+#define OPM_BISAI_HEADER_INCLUDED
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/TimingMacros.hpp>
+#include <opm/grid/utility/SparseTable.hpp>
+#include <opm/simulators/linalg/GraphColoring.hpp>
+#include <opm/simulators/linalg/LevelScheduling.hpp>
+#include <opm/simulators/linalg/PreconditionerWithUpdate.hpp>
+
+#include <dune/istl/bcrsmatrix.hh>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Opm
+{
+
+/*! \brief Block incomplete sparse approximate inverse (ISAI) preconditioner.
+ *  \details Computes the block ILU0 factors L and U of A, and approximate
+ *           inverses M_L of L and M_U of U with the sparsity patterns of L
+ *           and U, such that (M_L L)_ij = (M_U U)_ij = delta_ij on these
+ *           patterns. Every row of M_L and M_U is the solution of a small
+ *           independent triangular system, so the setup is parallel over
+ *           the rows. The triangular solves of ILU0 are replaced by the
+ *           two sparse matrix-vector products v = M_U M_L d, which have no
+ *           sequential dependencies.
+ *
+ *           See H. Anzt et al., Incomplete sparse approximate inverses for
+ *           parallel preconditioning, Parallel Comput. 71 (2018), and the
+ *           OpenCL version in gpubridge/opencl/openclBISAI.cpp.
+ *           With OpenMP, the ILU0 factorization in update() is level
+ *           scheduled, the rows of M_L and M_U are computed by all threads,
+ *           and apply() splits both products by rows.
+
+   \tparam M The matrix type to operate on
+   \tparam X Type of the update
+   \tparam Y Type of the defect
+*/
+template <class M, class X, class Y>
+class BISAI : public Dune::PreconditionerWithUpdate<X, Y>
+{
+public:
+    //! \brief The matrix type the preconditioner is for.
+    using matrix_type = M;
+    //! \brief The domain type of the preconditioner.
+    using domain_type = X;
+    //! \brief The range type of the preconditioner.
+    using range_type = Y;
+    //! \brief The field type of the preconditioner.
+    using field_type = typename X::field_type;
+
+    using block_type = typename M::block_type;
+
+    /*! \brief Constructor gets all parameters to operate the prec.
+       \param A The matrix to operate on.
+       \param w The relaxation factor.
+    */
+    BISAI(const M& A, const field_type w)
+        : A_(A)
+        , w_(w)
+        , ILU_(A)
+    {
+        OPM_TIMEBLOCK(prec_construct);
+        setupPattern();
+        lowerLevels_ = getMatrixRowColoring(A_, ColoringType::LOWER);
+        update();
+    }
+
+    /*!
+       \brief Update the preconditioner.
+       \copydoc Preconditioner::update()
+    */
+    void update() override
+    {
+        OPM_TIMEBLOCK(prec_update);
+        // The pattern of ILU_ is the one of A_.
+        for (std::size_t row = 0; row < A_.N(); ++row) {
+            auto ilu = ILU_[row].begin();
+            for (auto a = A_[row].begin(); a != A_[row].end(); ++a, ++ilu) {
+                *ilu = *a;
+            }
+        }
+        // Stores L below the diagonal and U above, with the inverted diagonal of U.
+        // The rows of a level of L only depend on rows of earlier levels.
+        detail::forEachRowByLevel(lowerLevels_, [this](const std::size_t row)
+                                  { detail::bilu0_decompose_row(ILU_, row); });
+
+        const int n = A_.N();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int row = 0; row < n; ++row) {
+            computeLowerInverseRow(row);
+            computeUpperInverseRow(row);
+        }
+    }
+
+    /*!
+       \brief Prepare the preconditioner.
+       \copydoc Preconditioner::pre(X&,Y&)
+    */
+    void pre(X&, Y&) override
+    {
+    }
+
+    /*!
+       \brief Apply the preconditioner.
+       \copydoc Preconditioner::apply(X&,const Y&)
+    */
+    void apply(X& v, const Y& d) override
+    {
+        OPM_TIMEBLOCK(prec_apply);
+        const int n = A_.N();
+        y_.resize(d.size());
+
+        // y = M_L d, M_L has a unit diagonal
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int i = 0; i < n; ++i) {
+            auto yi = d[i];
+            for (std::size_t ij = lowerStart_[i]; ij < lowerStart_[i + 1]; ++ij) {
+                lowerValues_[ij].umv(d[lowerCols_[ij]], yi);
+            }
+            y_[i] = yi;
+        }
+
+        // v = w * M_U y
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int i = 0; i < n; ++i) {
+            auto& vi = v[i];
+            vi = 0.0;
+            for (std::size_t ij = upperStart_[i]; ij < upperStart_[i + 1]; ++ij) {
+                upperValues_[ij].umv(y_[upperCols_[ij]], vi);
+            }
+            vi *= w_;
+        }
+    }
+
+    /*!
+       \brief Clean up.
+       \copydoc Preconditioner::post(X&)
+    */
+    void post(X&) override
+    {
+    }
+
+    //! Category of the preconditioner (see SolverCategory::Category)
+    Dune::SolverCategory::Category category() const override
+    {
+        return Dune::SolverCategory::sequential;
+    }
+
+    bool hasPerfectUpdate() const override
+    {
+        return true;
+    }
+
+private:
+    //! \brief The matrix we operate on.
+    const M& A_;
+    //! \brief The relaxation factor.
+    field_type w_;
+    //! \brief The ILU0 decomposition of A_.
+    M ILU_;
+    //! \brief The rows of A_ grouped into levels of the lower triangular part.
+    Opm::SparseTable<std::size_t> lowerLevels_;
+    //! \brief Strictly lower part of M_L in CSR format
+    std::vector<std::size_t> lowerStart_;
+    std::vector<std::size_t> lowerCols_;
+    std::vector<block_type> lowerValues_;
+    //! \brief M_U in CSR format, the diagonal block first in every row
+    std::vector<std::size_t> upperStart_;
+    std::vector<std::size_t> upperCols_;
+    std::vector<block_type> upperValues_;
+    //! \brief The intermediate vector M_L d.
+    Y y_;
+
+    void setupPattern()
+    {
+        const std::size_t n = A_.N();
+        lowerStart_.assign(n + 1, 0);
+        upperStart_.assign(n + 1, 0);
+        lowerCols_.clear();
+        upperCols_.clear();
+        for (auto row = A_.begin(); row != A_.end(); ++row) {
+            bool hasDiagonal = false;
+            for (auto col = row->begin(); col != row->end(); ++col) {
+                if (col.index() < row.index()) {
+                    lowerCols_.push_back(col.index());
+                } else {
+                    hasDiagonal = hasDiagonal || col.index() == row.index();
+                    upperCols_.push_back(col.index());
+                }
+            }
+            if (!hasDiagonal) {
+                OPM_THROW(std::logic_error,
+                          "BISAI: missing diagonal block in row " + std::to_string(row.index()));
+            }
+            lowerStart_[row.index() + 1] = lowerCols_.size();
+            upperStart_[row.index() + 1] = upperCols_.size();
+        }
+        lowerValues_.resize(lowerCols_.size());
+        upperValues_.resize(upperCols_.size());
+    }
+
+    //! \brief Solve (M_L L)_ik = delta_ik for the columns k of row i of M_L.
+    void computeLowerInverseRow(const std::size_t i)
+    {
+        const std::size_t first = lowerStart_[i];
+        // M_ik = -(L_ik + sum_{k<j<i} M_ij L_jk), from the last column to the first.
+        for (std::size_t ik = lowerStart_[i + 1]; ik-- > first; ) {
+            const std::size_t k = lowerCols_[ik];
+            block_type sum = ILU_[i][k];
+            for (std::size_t ij = ik + 1; ij < lowerStart_[i + 1]; ++ij) {
+                const auto& rowJ = ILU_[lowerCols_[ij]];
+                const auto jk = rowJ.find(k);
+                if (jk != rowJ.end()) {
+                    block_type product = *jk;
+                    product.leftmultiply(lowerValues_[ij]);
+                    sum += product;
+                }
+            }
+            sum *= -1.0;
+            lowerValues_[ik] = sum;
+        }
+    }
+
+    //! \brief Solve (M_U U)_ik = delta_ik for the columns k of row i of M_U.
+    void computeUpperInverseRow(const std::size_t i)
+    {
+        const std::size_t first = upperStart_[i];
+        // M_ii = U_ii^-1, which ILU_ stores on the diagonal
+        upperValues_[first] = ILU_[i][i];
+        // M_ik = -(sum_{i<=j<k} M_ij U_jk) U_kk^-1, from the first column to the last.
+        for (std::size_t ik = first + 1; ik < upperStart_[i + 1]; ++ik) {
+            const std::size_t k = upperCols_[ik];
+            block_type sum = 0.0;
+            for (std::size_t ij = first; ij < ik; ++ij) {
+                const auto& rowJ = ILU_[upperCols_[ij]];
+                const auto jk = rowJ.find(k);
+                if (jk != rowJ.end()) {
+                    block_type product = *jk;
+                    product.leftmultiply(upperValues_[ij]);
+                    sum += product;
+                }
+            }
+            sum.rightmultiply(ILU_[k][k]);
+            sum *= -1.0;
+            upperValues_[ik] = sum;
+        }
+    }
+};
+
+} // namespace Opm
+
+#endif // OPM_BISAI_HEADER_INCLUDED
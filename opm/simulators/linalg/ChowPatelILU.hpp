@@ -0,0 +1,319 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_CHOWPATELILU_HEADER_INCLUDED
+#define OPM_CHOWPATELILU_HEADER_INCLUDED
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/TimingMacros.hpp>
+#include <opm/grid/utility/SparseTable.hpp>
+#include <opm/simulators/linalg/GraphColoring.hpp>
+#include <opm/simulators/linalg/LevelScheduling.hpp>
+#include <opm/simulators/linalg/PreconditionerWithUpdate.hpp>
+
+#include <dune/istl/bcrsmatrix.hh>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Opm
+{
+
+/*! \brief The fine-grained parallel ILU0 preconditioner of Chow and Patel.
+ *  \details The ILU0 factors are approximated by a number of fixed-point
+ *           sweeps over all nonzero blocks of A. Each sweep only reads the
+ *           factors of the previous sweep, so all blocks can be updated
+ *           concurrently:
+ *
+ *             L_ij = (A_ij - sum_{k<j} L_ik U_kj) U_jj^-1   for i > j
+ *             U_ij =  A_ij - sum_{k<i} L_ik U_kj            for i <= j
+ *
+ *           See E. Chow and A. Patel, Fine-grained parallel incomplete LU
+ *           factorization, SIAM J. Sci. Comput. 37 (2015), and the OpenCL
+ *           version in gpubridge/opencl/ChowPatelIlu.cpp. With OpenMP, the
+ *           rows of A are split between the threads in every sweep. The
+ *           triangular solves in apply() stay exact and are level scheduled
+ *           on the row colorings of L and U instead.
+
+   \tparam M The matrix type to operate on
+   \tparam X Type of the update
+   \tparam Y Type of the defect
+*/
+template <class M, class X, class Y>
+class ChowPatelILU : public Dune::PreconditionerWithUpdate<X, Y>
+{
+public:
+    //! \brief The matrix type the preconditioner is for.
+    using matrix_type = M;
+    //! \brief The domain type of the preconditioner.
+    using domain_type = X;
+    //! \brief The range type of the preconditioner.
+    using range_type = Y;
+    //! \brief The field type of the preconditioner.
+    using field_type = typename X::field_type;
+
+    using block_type = typename M::block_type;
+
+    /*! \brief Constructor gets all parameters to operate the prec.
+       \param A The matrix to operate on.
+       \param sweeps The number of fixed-point sweeps of the factorization.
+    */
+    ChowPatelILU(const M& A, const int sweeps)
+        : A_(A)
+        , sweeps_(sweeps)
+    {
+        OPM_TIMEBLOCK(prec_construct);
+        setupPattern();
+        lowerLevels_ = getMatrixRowColoring(A_, ColoringType::LOWER);
+        upperLevels_ = getMatrixRowColoring(A_, ColoringType::UPPER);
+        update();
+    }
+
+    /*!
+       \brief Update the preconditioner.
+       \copydoc Preconditioner::update()
+    */
+    void update() override
+    {
+        OPM_TIMEBLOCK(prec_update);
+        const int n = A_.N();
+
+        // Initial guess: L = L_A D_A^-1, U = D_A + U_A
+        copyValues(values_);
+        invertDiagonal(values_);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int i = 0; i < n; ++i) {
+            for (std::size_t ij = rowStart_[i]; ij < diag_[i]; ++ij) {
+                values_[ij].rightmultiply(invDiag_[cols_[ij]]);
+            }
+        }
+
+        next_.resize(values_.size());
+        for (int sweep = 0; sweep < sweeps_; ++sweep) {
+            this->sweep();
+            std::swap(values_, next_);
+            invertDiagonal(values_);
+        }
+    }
+
+    /*!
+       \brief Prepare the preconditioner.
+       \copydoc Preconditioner::pre(X&,Y&)
+    */
+    void pre(X&, Y&) override
+    {
+    }
+
+    /*!
+       \brief Apply the preconditioner.
+       \copydoc Preconditioner::apply(X&,const Y&)
+    */
+    void apply(X& v, const Y& d) override
+    {
+        OPM_TIMEBLOCK(prec_apply);
+        // Solve L y = d, L has a unit diagonal
+        detail::forEachRowByLevel(lowerLevels_, [&](const std::size_t i) {
+            auto rhs = d[i];
+            for (std::size_t ij = rowStart_[i]; ij < diag_[i]; ++ij) {
+                values_[ij].mmv(v[cols_[ij]], rhs);
+            }
+            v[i] = rhs;
+        });
+
+        // Solve U v = y
+        detail::forEachRowByLevel(upperLevels_, [&](const std::size_t i) {
+            auto rhs = v[i];
+            for (std::size_t ij = diag_[i] + 1; ij < rowStart_[i + 1]; ++ij) {
+                values_[ij].mmv(v[cols_[ij]], rhs);
+            }
+            invDiag_[i].mv(rhs, v[i]);
+        });
+    }
+
+    /*!
+       \brief Clean up.
+       \copydoc Preconditioner::post(X&)
+    */
+    void post(X&) override
+    {
+    }
+
+    //! Category of the preconditioner (see SolverCategory::Category)
+    Dune::SolverCategory::Category category() const override
+    {
+        return Dune::SolverCategory::sequential;
+    }
+
+    bool hasPerfectUpdate() const override
+    {
+        return true;
+    }
+
+private:
+    //! \brief The matrix we operate on.
+    const M& A_;
+    //! \brief The number of fixed-point sweeps.
+    int sweeps_;
+    //! \brief Position of the first block of each row, the pattern of A in CSR format
+    std::vector<std::size_t> rowStart_;
+    //! \brief Column index of each block
+    std::vector<std::size_t> cols_;
+    //! \brief Position of the diagonal block of each row
+    std::vector<std::size_t> diag_;
+    //! \brief Position of the first product of each block in products_
+    std::vector<std::size_t> productStart_;
+    //! \brief For each block (i, j) the positions of the blocks (i, k) and (k, j)
+    //!        with k < min(i, j)
+    std::vector<std::pair<std::size_t, std::size_t>> products_;
+    //! \brief The factors, L (without unit diagonal) and U in the pattern of A
+    std::vector<block_type> values_;
+    //! \brief The factors computed by the current sweep
+    std::vector<block_type> next_;
+    //! \brief Inverse of the diagonal blocks of U
+    std::vector<block_type> invDiag_;
+    //! \brief Rows grouped by level for the lower triangular solve
+    Opm::SparseTable<std::size_t> lowerLevels_;
+    //! \brief Rows grouped by level for the upper triangular solve
+    Opm::SparseTable<std::size_t> upperLevels_;
+
+    void setupPattern()
+    {
+        const std::size_t n = A_.N();
+        rowStart_.assign(n + 1, 0);
+        cols_.clear();
+        cols_.reserve(A_.nonzeroes());
+        diag_.assign(n, 0);
+        for (auto row = A_.begin(); row != A_.end(); ++row) {
+            bool hasDiagonal = false;
+            for (auto col = row->begin(); col != row->end(); ++col) {
+                if (col.index() == row.index()) {
+                    diag_[row.index()] = cols_.size();
+                    hasDiagonal = true;
+                }
+                cols_.push_back(col.index());
+            }
+            if (!hasDiagonal) {
+                OPM_THROW(std::logic_error,
+                          "ChowPatelILU: missing diagonal block in row " + std::to_string(row.index()));
+            }
+            rowStart_[row.index() + 1] = cols_.size();
+        }
+
+        // For every block (i, j) find the pairs (i, k), (k, j) with k < min(i, j).
+        productStart_.assign(cols_.size() + 1, 0);
+        products_.clear();
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t ij = rowStart_[i]; ij < rowStart_[i + 1]; ++ij) {
+                const std::size_t j = cols_[ij];
+                for (std::size_t ik = rowStart_[i]; ik < rowStart_[i + 1] && cols_[ik] < std::min(i, j); ++ik) {
+                    const std::size_t k = cols_[ik];
+                    const auto kBegin = cols_.begin() + rowStart_[k];
+                    const auto kEnd = cols_.begin() + rowStart_[k + 1];
+                    const auto kj = std::lower_bound(kBegin, kEnd, j);
+                    if (kj != kEnd && *kj == j) {
+                        products_.emplace_back(ik, kj - cols_.begin());
+                    }
+                }
+                productStart_[ij + 1] = products_.size();
+            }
+        }
+    }
+
+    //! \brief Copy the values of A in the pattern order.
+    void copyValues(std::vector<block_type>& values) const
+    {
+        values.resize(cols_.size());
+        const int n = A_.N();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int i = 0; i < n; ++i) {
+            std::size_t ij = rowStart_[i];
+            for (auto col = A_[i].begin(); col != A_[i].end(); ++col, ++ij) {
+                values[ij] = *col;
+            }
+        }
+    }
+
+    //! \brief Store the inverse of the diagonal blocks of values in invDiag_.
+    void invertDiagonal(const std::vector<block_type>& values)
+    {
+        const int n = A_.N();
+        invDiag_.resize(n);
+        // Exceptions must not escape the parallel region, the first one is rethrown.
+        std::exception_ptr exception;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int i = 0; i < n; ++i) {
+            try {
+                invDiag_[i] = values[diag_[i]];
+                invDiag_[i].invert();
+            }
+            catch (...) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    //! \brief One fixed-point sweep, reading values_ and writing next_.
+    void sweep()
+    {
+        OPM_TIMEBLOCK(chowPatelSweep);
+        const int n = A_.N();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int i = 0; i < n; ++i) {
+            std::size_t ij = rowStart_[i];
+            for (auto a_ij = A_[i].begin(); a_ij != A_[i].end(); ++a_ij, ++ij) {
+                block_type s = *a_ij;
+                for (std::size_t p = productStart_[ij]; p < productStart_[ij + 1]; ++p) {
+                    // s -= L_ik * U_kj
+                    block_type product = values_[products_[p].second];
+                    product.leftmultiply(values_[products_[p].first]);
+                    s -= product;
+                }
+                if (cols_[ij] < static_cast<std::size_t>(i)) {
+                    s.rightmultiply(invDiag_[cols_[ij]]);
+                }
+                next_[ij] = s;
+            }
+        }
+    }
+};
+
+} // namespace Opm
+
+#endif // OPM_CHOWPATELILU_HEADER_INCLUDED
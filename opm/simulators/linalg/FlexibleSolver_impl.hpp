@@ -195,11 +195,12 @@ namespace Dune
                 const std::string prec_type = prm.get<std::string>("preconditioner.type", "error");
                 bool use_mixed_dilu= (prec_type=="mixed-dilu");
                 using MatrixType = decltype(linearoperator_for_solver_->getmat());
-                linsolver_ = std::make_shared<Dune::MixedSolver<VectorType,MatrixType>>(
+                linsolver_ = std::make_shared<Dune::MixedSolver<VectorType,MatrixType,Comm>>(
                                                                             linearoperator_for_solver_->getmat(),
                                                                             tol,
                                                                             maxiter,
-                                                                            use_mixed_dilu
+                                                                            use_mixed_dilu,
+                                                                            comm
                                                                         );
             }
 #endif
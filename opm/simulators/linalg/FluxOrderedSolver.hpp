@@ -0,0 +1,266 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_FLUX_ORDERED_SOLVER_HEADER_INCLUDED
+#define OPM_FLUX_ORDERED_SOLVER_HEADER_INCLUDED
+
+#include <opm/common/TimingMacros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Opm
+{
+
+/*! \brief Direct solver for upwind transport matrices, ordering the cells
+ *         along the flow.
+ *
+ *  \details In an upwind discretization on a fixed flow field, the
+ *           off-diagonal block (i, j) is only nonzero if the flow goes from
+ *           cell j into cell i. Ordering the strongly connected components
+ *           of this dependency graph topologically (Tarjan's algorithm) makes
+ *           the matrix block lower triangular. Components of a single cell
+ *           are solved exactly by forward substitution. Only components
+ *           containing circulation cycles are solved iteratively, by block
+ *           Gauss-Seidel sweeps until the residual of the component is
+ *           reduced by the given factor.
+ *
+ *  \tparam M The matrix type
+ *  \tparam X The vector type
+ */
+template <class M, class X>
+class FluxOrderedSolver
+{
+public:
+    using field_type = typename X::field_type;
+
+    /*! \brief Constructor orders the cells and inverts the diagonal blocks.
+     *  \param A The matrix
+     *  \param reduction Residual reduction required in cyclic components
+     *  \param maxSweeps Maximum number of sweeps over a cyclic component
+     */
+    FluxOrderedSolver(const M& A, const field_type reduction, const int maxSweeps)
+        : A_(A)
+        , reduction_(reduction)
+        , maxSweeps_(maxSweeps)
+    {
+        OPM_TIMEBLOCK(fluxOrdering);
+        this->computeOrder_();
+
+        diagInv_.resize(A_.N());
+        for (auto row = A_.begin(); row != A_.end(); ++row) {
+            diagInv_[row.index()] = A_[row.index()][row.index()];
+            diagInv_[row.index()].invert();
+        }
+    }
+
+    /*! \brief Solve A x[k] = b[k] for all right-hand sides.
+     *  \param x Initial guesses on entry, solutions on exit
+     *  \param b Right-hand sides
+     *  \return True if the iterations of all cyclic components converged
+     *  \details If false is returned, x holds the solution up to the first
+     *           unconverged component, which is a good initial guess for
+     *           an iterative solver.
+     */
+    bool apply(std::vector<X>& x, const std::vector<X>& b)
+    {
+        OPM_TIMEBLOCK(fluxOrderedSolve);
+        rhs_.resize(b.size());
+        for (std::size_t c = 0; c + 1 < componentStart_.size(); ++c) {
+            const auto begin = componentStart_[c];
+            const auto end = componentStart_[c + 1];
+            if (end - begin == 1) {
+                this->updateCell_(order_[begin], x, b, nullptr);
+            } else if (!this->solveCycle_(begin, end, x, b)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //! \brief Number of strongly connected components.
+    std::size_t numComponents() const
+    { return componentStart_.size() - 1; }
+
+    //! \brief Number of cells in components with circulation cycles.
+    std::size_t numCyclicCells() const
+    { return numCyclicCells_; }
+
+private:
+    using Block = typename M::block_type;
+    using VectorBlock = typename X::block_type;
+
+    //! \brief Whether a block couples two cells.
+    static bool isCoupling_(const Block& block)
+    { return block.infinity_norm() > 0.0; }
+
+    //! \brief Orders the cells by Tarjan's strongly connected components algorithm.
+    //! \details Tarjan emits a component after all components it depends on,
+    //!          which is the order they need to be solved in. The depth-first
+    //!          search uses an explicit stack, as flow paths can be very long.
+    void computeOrder_()
+    {
+        constexpr auto unvisited = std::numeric_limits<std::size_t>::max();
+        const std::size_t n = A_.N();
+        std::vector<std::size_t> index(n, unvisited);
+        std::vector<std::size_t> lowlink(n);
+        std::vector<char> onStack(n, 0);
+        std::vector<std::size_t> stack;
+        std::vector<std::pair<std::size_t, typename M::ConstColIterator>> callStack;
+        std::size_t counter = 0;
+
+        order_.clear();
+        order_.reserve(n);
+        componentStart_.assign(1, 0);
+        numCyclicCells_ = 0;
+
+        auto visit = [&](const std::size_t cell)
+        {
+            index[cell] = lowlink[cell] = counter++;
+            stack.push_back(cell);
+            onStack[cell] = 1;
+            callStack.emplace_back(cell, A_[cell].begin());
+        };
+
+        for (std::size_t root = 0; root < n; ++root) {
+            if (index[root] != unvisited) {
+                continue;
+            }
+            visit(root);
+            while (!callStack.empty()) {
+                const std::size_t cell = callStack.back().first;
+                auto& col = callStack.back().second;
+                const auto end = A_[cell].end();
+                std::size_t next = unvisited;
+                for (; col != end; ++col) {
+                    const std::size_t upstream = col.index();
+                    if (upstream == cell || !isCoupling_(*col)) {
+                        continue;
+                    }
+                    if (index[upstream] == unvisited) {
+                        next = upstream;
+                        ++col;
+                        break;
+                    }
+                    if (onStack[upstream]) {
+                        lowlink[cell] = std::min(lowlink[cell], index[upstream]);
+                    }
+                }
+                if (next != unvisited) {
+                    visit(next);
+                    continue;
+                }
+
+                if (lowlink[cell] == index[cell]) {
+                    std::size_t member;
+                    do {
+                        member = stack.back();
+                        stack.pop_back();
+                        onStack[member] = 0;
+                        order_.push_back(member);
+                    } while (member != cell);
+                    const std::size_t size = order_.size() - componentStart_.back();
+                    if (size > 1) {
+                        numCyclicCells_ += size;
+                    }
+                    componentStart_.push_back(order_.size());
+                }
+                callStack.pop_back();
+                if (!callStack.empty()) {
+                    auto& parent = lowlink[callStack.back().first];
+                    parent = std::min(parent, lowlink[cell]);
+                }
+            }
+        }
+    }
+
+    //! \brief Block Jacobi update of one cell for all right-hand sides.
+    //! \details Exact if all cells the cell depends on are solved.
+    //! \param norms If not null, adds the squared residual norms of the cell
+    void updateCell_(const std::size_t cell,
+                     std::vector<X>& x,
+                     const std::vector<X>& b,
+                     std::vector<field_type>* norms)
+    {
+        const std::size_t numRhs = b.size();
+        for (std::size_t k = 0; k < numRhs; ++k) {
+            rhs_[k] = b[k][cell];
+        }
+        const auto& row = A_[cell];
+        for (auto col = row.begin(); col != row.end(); ++col) {
+            const auto& block = *col;
+            const auto j = col.index();
+            for (std::size_t k = 0; k < numRhs; ++k) {
+                block.mmv(x[k][j], rhs_[k]);
+            }
+        }
+        for (std::size_t k = 0; k < numRhs; ++k) {
+            if (norms) {
+                (*norms)[k] += rhs_[k].two_norm2();
+            }
+            diagInv_[cell].umv(rhs_[k], x[k][cell]);
+        }
+    }
+
+    //! \brief Solve a component with circulation cycles by Gauss-Seidel sweeps.
+    bool solveCycle_(const std::size_t begin,
+                     const std::size_t end,
+                     std::vector<X>& x,
+                     const std::vector<X>& b)
+    {
+        const std::size_t numRhs = b.size();
+        std::vector<field_type> initial(numRhs, 0.0);
+        std::vector<field_type> norms(numRhs);
+        for (int sweep = 0; sweep < maxSweeps_; ++sweep) {
+            std::ranges::fill(norms, 0.0);
+            for (std::size_t pos = begin; pos < end; ++pos) {
+                this->updateCell_(order_[pos], x, b, &norms);
+            }
+            if (sweep == 0) {
+                initial = norms;
+            }
+            // The residuals are those before the update of each cell, so
+            // the sweep which detects convergence improves the result further.
+            bool converged = true;
+            for (std::size_t k = 0; k < numRhs; ++k) {
+                converged = converged && norms[k] <= reduction_ * reduction_ * initial[k];
+            }
+            if (converged) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const M& A_;
+    field_type reduction_;
+    int maxSweeps_;
+    std::vector<std::size_t> order_; //!< Cells in solution order
+    std::vector<std::size_t> componentStart_; //!< Start of each component in order_
+    std::size_t numCyclicCells_ = 0;
+    std::vector<Block> diagInv_; //!< Inverted diagonal blocks
+    std::vector<VectorBlock> rhs_; //!< Residual of the current cell, per right-hand side
+};
+
+} // namespace Opm
+
+#endif // OPM_FLUX_ORDERED_SOLVER_HEADER_INCLUDED
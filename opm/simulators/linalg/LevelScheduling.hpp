@@ -0,0 +1,130 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_LEVEL_SCHEDULING_HEADER_INCLUDED
+#define OPM_LEVEL_SCHEDULING_HEADER_INCLUDED
+
+#include <dune/common/fmatrix.hh>
+#include <dune/istl/istlexception.hh>
+
+#include <opm/grid/utility/SparseTable.hpp>
+
+#include <cstddef>
+#include <exception>
+
+namespace Opm
+{
+namespace detail
+{
+
+//! Compute Blocked ILU0 decomposition of a single row of A. All rows the
+//! row depends on, i.e. the rows of the entries left of the diagonal, must
+//! already be decomposed.
+template<class M>
+void bilu0_decompose_row (M& A, std::size_t row)
+{
+    // iterator types
+    using coliterator = typename M::ColIterator;
+    using block = typename M::block_type;
+
+    auto& rowI = A[row];
+
+    // implement left looking variant with stored inverse
+    // coliterator is diagonal after the following loop
+    coliterator endij=rowI.end();           // end of row i
+    coliterator ij;
+
+    // eliminate entries left of diagonal; store L factor
+    for (ij=rowI.begin(); ij.index()<row; ++ij)
+    {
+        // find A_jj which eliminates A_ij
+        coliterator jj = A[ij.index()].find(ij.index());
+
+        // compute L_ij = A_jj^-1 * A_ij
+        (*ij).rightmultiply(*jj);
+
+        // modify row
+        coliterator endjk=A[ij.index()].end();    // end of row j
+        coliterator jk=jj; ++jk;
+        coliterator ik=ij; ++ik;
+        while (ik!=endij && jk!=endjk)
+            if (ik.index()==jk.index())
+            {
+                block B(*jk);
+                B.leftmultiply(*ij);
+                *ik -= B;
+                ++ik; ++jk;
+            }
+            else
+            {
+                if (ik.index()<jk.index())
+                    ++ik;
+                else
+                    ++jk;
+            }
+    }
+
+    // invert pivot and store it in A
+    if (ij.index()!=row)
+        DUNE_THROW(Dune::ISTLError,"diagonal entry missing");
+    try {
+        (*ij).invert();   // compute inverse of diagonal block
+    }
+    catch (Dune::FMatrixError & e) {
+        DUNE_THROW(Dune::ISTLError,"ILU failed to invert matrix block");
+    }
+}
+
+//! Call f(row) for all rows of the levels, one level after another.
+//! The rows of a level are processed concurrently. An exception thrown
+//! by f is rethrown after the level has been processed.
+template<class F>
+void forEachRowByLevel(const Opm::SparseTable<std::size_t>& levels, const F& f)
+{
+    for (int level = 0; level < levels.size(); ++level)
+    {
+        const auto& rows = levels[level];
+        const int numRows = rows.size();
+        std::exception_ptr exception;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int i = 0; i < numRows; ++i)
+        {
+            try {
+                f(rows.begin()[i]);
+            }
+            catch (...) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                exception = std::current_exception();
+            }
+        }
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+} // end namespace detail
+} // end namespace Opm
+
+#endif // OPM_LEVEL_SCHEDULING_HEADER_INCLUDED
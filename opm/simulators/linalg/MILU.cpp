@@ -77,85 +77,101 @@ namespace detail
 {
 
 template<class M>
-void milu0_decomposition(M& A, FieldFunct<M> absFunctor, FieldFunct<M> signFunctor,
-                         std::vector<typename M::block_type>* diagonal)
+void milu0_decompose_row(M& A, std::size_t row, FieldFunct<M> absFunctor,
+                         FieldFunct<M> signFunctor, typename M::block_type* diagonal)
 {
-    if( diagonal )
-    {
-        diagonal->reserve(A.N());
-    }
+    auto& irow = A[row];
+    auto a_i_end = irow.end();
+    auto a_ik    = irow.begin();
 
-    for ( auto irow = A.begin(), iend = A.end(); irow != iend; ++irow)
-    {
-        auto a_i_end = irow->end();
-        auto a_ik    = irow->begin();
-
-        std::array<typename M::field_type, M::block_type::rows> sum_dropped{};
+    std::array<typename M::field_type, M::block_type::rows> sum_dropped{};
 
-        // Eliminate entries in lower triangular matrix
-        // and store factors for L
-        for ( ; a_ik.index() < irow.index(); ++a_ik )
+    // Eliminate entries in lower triangular matrix
+    // and store factors for L
+    for ( ; a_ik.index() < row; ++a_ik )
+    {
+        auto k = a_ik.index();
+        auto a_kk = A[k].find(k);
+        // L_ik = A_kk^-1 * A_ik
+        a_ik->rightmultiply(*a_kk);
+
+        // modify the rest of the row, everything right of a_ik
+        // a_i* -=a_ik * a_k*
+        auto a_k_end = A[k].end();
+        auto a_kj = a_kk, a_ij = a_ik;
+        ++a_kj; ++a_ij;
+
+        while ( a_kj != a_k_end)
         {
-            auto k = a_ik.index();
-            auto a_kk = A[k].find(k);
-            // L_ik = A_kk^-1 * A_ik
-            a_ik->rightmultiply(*a_kk);
-
-            // modify the rest of the row, everything right of a_ik
-            // a_i* -=a_ik * a_k*
-            auto a_k_end = A[k].end();
-            auto a_kj = a_kk, a_ij = a_ik;
-            ++a_kj; ++a_ij;
-
-            while ( a_kj != a_k_end)
-            {
-                auto modifier = *a_kj;
-                modifier.leftmultiply(*a_ik);
+            auto modifier = *a_kj;
+            modifier.leftmultiply(*a_ik);
 
-                while( a_ij != a_i_end && a_ij.index() < a_kj.index())
-                {
-                    ++a_ij;
-                }
+            while( a_ij != a_i_end && a_ij.index() < a_kj.index())
+            {
+                ++a_ij;
+            }
 
-                if ( a_ij != a_i_end && a_ij.index() == a_kj.index() )
-                {
-                    // Value is not dropped
-                    *a_ij -= modifier;
-                    ++a_ij; ++a_kj;
-                }
-                else
+            if ( a_ij != a_i_end && a_ij.index() == a_kj.index() )
+            {
+                // Value is not dropped
+                *a_ij -= modifier;
+                ++a_ij; ++a_kj;
+            }
+            else
+            {
+                auto entry = sum_dropped.begin();
+                for( const auto& mrow: modifier )
                 {
-                    auto entry = sum_dropped.begin();
-                    for( const auto& row: modifier )
+                    for( const auto& colEntry: mrow )
                     {
-                        for( const auto& colEntry: row )
-                        {
-                            *entry += absFunctor(-colEntry);
-                        }
-                        ++entry;
+                        *entry += absFunctor(-colEntry);
                     }
-                    ++a_kj;
+                    ++entry;
                 }
+                ++a_kj;
             }
         }
+    }
 
-        if ( a_ik.index() != irow.index() )
-            OPM_THROW(std::logic_error,
-                      "Matrix is missing diagonal for row " + std::to_string(irow.index()));
+    if ( a_ik.index() != row )
+        OPM_THROW(std::logic_error,
+                  "Matrix is missing diagonal for row " + std::to_string(row));
 
-        int index = 0;
-        for(const auto& entry: sum_dropped)
-        {
-            auto& bdiag = (*a_ik)[index][index];
-            bdiag += signFunctor(bdiag) * entry;
-            ++index;
-        }
+    int index = 0;
+    for(const auto& entry: sum_dropped)
+    {
+        auto& bdiag = (*a_ik)[index][index];
+        bdiag += signFunctor(bdiag) * entry;
+        ++index;
+    }
 
+    if ( diagonal )
+    {
+        *diagonal = *a_ik;
+    }
+    a_ik->invert();   // compute inverse of diagonal block
+}
+
+template<class M>
+void milu0_decomposition(M& A, FieldFunct<M> absFunctor, FieldFunct<M> signFunctor,
+                         std::vector<typename M::block_type>* diagonal)
+{
+    if( diagonal )
+    {
+        diagonal->reserve(A.N());
+    }
+
+    for (std::size_t row = 0; row < A.N(); ++row)
+    {
         if ( diagonal )
         {
-            diagonal->push_back(*a_ik);
+            diagonal->emplace_back();
+            milu0_decompose_row(A, row, absFunctor, signFunctor, &diagonal->back());
+        }
+        else
+        {
+            milu0_decompose_row(A, row, absFunctor, signFunctor);
         }
-        a_ik->invert();   // compute inverse of diagonal block
     }
 }
 
@@ -258,7 +274,11 @@ void milun_decomposition(const M& A, int n, MILU_VARIANT milu, M& ILU,
 #define INSTANTIATE(T, ...)                                               \
     template void milu0_decomposition<__VA_ARGS__>                        \
     (__VA_ARGS__&,std::function<T(const T&)>, std::function<T(const T&)>, \
-    std::vector<typename __VA_ARGS__::block_type>*);
+    std::vector<typename __VA_ARGS__::block_type>*);                      \
+    template void milu0_decompose_row<__VA_ARGS__>                        \
+    (__VA_ARGS__&, std::size_t,                                           \
+    std::function<T(const T&)>, std::function<T(const T&)>,               \
+    typename __VA_ARGS__::block_type*);
 
 #define INSTANTIATE_ILUN(...)                                                \
     template void milun_decomposition(const __VA_ARGS__&, int, MILU_VARIANT, \
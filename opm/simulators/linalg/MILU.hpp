@@ -103,6 +103,15 @@ void milu0_decomposition(M& A, FieldFunct<M> absFunctor = signFunctor<typename M
                          FieldFunct<M> signFunctor = oneFunctor<typename M::field_type>,
                          std::vector<typename M::block_type>* diagonal = nullptr);
 
+//! \brief Compute the MILU0 decomposition of a single row of A.
+//! \details All rows the row depends on, i.e. the rows of the entries left
+//!          of the diagonal, must already be decomposed.
+//! \param diagonal If not null, the diagonal block before inversion is stored here.
+template <typename M>
+void milu0_decompose_row(M& A, std::size_t row, FieldFunct<M> absFunctor,
+                         FieldFunct<M> signFunctor,
+                         typename M::block_type* diagonal = nullptr);
+
 template<class M>
 void  milu0_decomposition(M& A, std::vector<typename M::block_type>* diagonal)
 {
@@ -0,0 +1,298 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_MULTI_RHS_BICGSTAB_HEADER_INCLUDED
+#define OPM_MULTI_RHS_BICGSTAB_HEADER_INCLUDED
+
+#include <opm/common/TimingMacros.hpp>
+
+#include <dune/istl/ilu.hh>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace Opm
+{
+
+/*! \brief ILU0 preconditioned BiCGSTAB for several right-hand sides
+ *         sharing one matrix.
+ *
+ *  \details Every right-hand side runs its own BiCGSTAB iteration, with the
+ *           same steps and stopping criterion as Dune::BiCGSTABSolver with a
+ *           Dune::SeqILU preconditioner. The matrix products and the
+ *           triangular solves of all right-hand sides which have not yet
+ *           converged are done in a single sweep over the matrix and the ILU
+ *           factors, so every block is loaded once per iteration rather than
+ *           once per right-hand side.
+ *
+ *  \tparam M The matrix type
+ *  \tparam X The vector type
+ */
+template <class M, class X>
+class MultiRhsBiCGSTAB
+{
+public:
+    using field_type = typename X::field_type;
+
+    /*! \brief Constructor computes the ILU0 factors of the matrix.
+     *  \param A The matrix
+     *  \param reduction Relative reduction of the residual norm to reach
+     *  \param maxIter Maximum number of iterations
+     */
+    MultiRhsBiCGSTAB(const M& A, const field_type reduction, const int maxIter)
+        : A_(A)
+        , ILU_(A)
+        , reduction_(reduction)
+        , maxIter_(maxIter)
+    {
+        OPM_TIMEBLOCK(prec_construct);
+        Dune::ILU::blockILU0Decomposition(ILU_);
+    }
+
+    /*! \brief Solve A x[k] = b[k] for all right-hand sides.
+     *  \param x Initial guesses on entry, solutions on exit
+     *  \param b Right-hand sides
+     *  \return True if all right-hand sides converged
+     */
+    bool apply(std::vector<X>& x, const std::vector<X>& b)
+    {
+        OPM_TIMEBLOCK(multiRhsBiCGSTAB);
+        const std::size_t numRhs = b.size();
+        iterations_ = 0;
+
+        std::vector<State> states(numRhs);
+        std::vector<std::size_t> active;
+        for (std::size_t k = 0; k < numRhs; ++k) {
+            auto& s = states[k];
+            s.r = b[k];
+            A_.mmv(x[k], s.r);
+            s.rt = s.r;
+            s.p.resize(b[k].size());
+            s.p = 0.0;
+            s.v = s.p;
+            s.y = s.p;
+            s.t = s.p;
+            s.def0 = s.r.two_norm();
+            if (s.def0 < absoluteTolerance) {
+                s.converged = true;
+            } else {
+                active.push_back(k);
+            }
+        }
+
+        std::vector<const X*> in;
+        std::vector<X*> y;
+        std::vector<X*> out;
+        for (double it = 0.5; it < maxIter_ && !active.empty(); it += 0.5) {
+            // First half step: p, y = M^{-1} p and v = A y.
+            for (const auto k : active) {
+                auto& s = states[k];
+                if (std::abs(s.rho) <= epsilon) {
+                    s.breakdown = true;
+                    continue;
+                }
+                s.rhoNew = s.rt.dot(s.r);
+                if (it < 1) {
+                    s.p = s.r;
+                } else {
+                    const field_type beta = (s.rhoNew / s.rho) * (s.alpha / s.omega);
+                    s.p.axpy(-s.omega, s.v);
+                    s.p *= beta;
+                    s.p += s.r;
+                }
+            }
+            removeInactive_(states, active);
+            this->gather_(states, active, &State::p, &State::y, &State::v, in, y, out);
+            this->precondition_(y, in);
+            this->multiply_(out, y);
+
+            for (const auto k : active) {
+                auto& s = states[k];
+                const field_type h = s.rt.dot(s.v);
+                if (std::abs(h) < epsilon) {
+                    s.breakdown = true;
+                    continue;
+                }
+                s.alpha = s.rhoNew / h;
+                x[k].axpy(s.alpha, s.y);
+                s.r.axpy(-s.alpha, s.v);
+                s.converged = this->converged_(s.r.two_norm(), s.def0);
+            }
+            removeInactive_(states, active);
+            iterations_ = it;
+            if (active.empty()) {
+                break;
+            }
+
+            // Second half step: y = M^{-1} r and t = A y.
+            it += 0.5;
+            this->gather_(states, active, &State::r, &State::y, &State::t, in, y, out);
+            this->precondition_(y, in);
+            this->multiply_(out, y);
+
+            for (const auto k : active) {
+                auto& s = states[k];
+                s.omega = s.t.dot(s.r) / s.t.dot(s.t);
+                x[k].axpy(s.omega, s.y);
+                s.r.axpy(-s.omega, s.t);
+                s.rho = s.rhoNew;
+                s.converged = this->converged_(s.r.two_norm(), s.def0);
+            }
+            removeInactive_(states, active);
+            iterations_ = it;
+        }
+
+        bool converged = true;
+        for (const auto& s : states) {
+            converged = converged && s.converged;
+        }
+        return converged;
+    }
+
+    //! \brief Number of iterations of the slowest right-hand side in the last apply().
+    double iterations() const
+    { return iterations_; }
+
+private:
+    static constexpr field_type epsilon = 1e-80;
+    //! \brief Absolute defect below which a right-hand side counts as converged.
+    static constexpr field_type absoluteTolerance = 1e-30;
+
+    //! \brief Iteration state of one right-hand side.
+    struct State
+    {
+        X r, rt, p, v, y, t;
+        field_type rho = 1.0;
+        field_type rhoNew = 1.0;
+        field_type alpha = 1.0;
+        field_type omega = 1.0;
+        field_type def0 = 0.0;
+        bool converged = false;
+        bool breakdown = false;
+    };
+
+    //! \brief Convergence test of Dune::IterativeSolver, relative or absolute.
+    bool converged_(const field_type def, const field_type def0) const
+    { return def < reduction_ * def0 || def < absoluteTolerance; }
+
+    //! \brief Drop converged and broken down right-hand sides from the active set.
+    static void removeInactive_(const std::vector<State>& states,
+                                std::vector<std::size_t>& active)
+    {
+        std::erase_if(active, [&states](const std::size_t k)
+                              { return states[k].converged || states[k].breakdown; });
+    }
+
+    //! \brief Collects the vectors of the active right-hand sides used by a half step.
+    static void gather_(std::vector<State>& states,
+                        const std::vector<std::size_t>& active,
+                        X State::* precIn, X State::* precOut, X State::* mvOut,
+                        std::vector<const X*>& in,
+                        std::vector<X*>& y,
+                        std::vector<X*>& out)
+    {
+        in.clear();
+        y.clear();
+        out.clear();
+        for (const auto k : active) {
+            in.push_back(&(states[k].*precIn));
+            y.push_back(&(states[k].*precOut));
+            out.push_back(&(states[k].*mvOut));
+        }
+    }
+
+    //! \brief Computes out[k] = A in[k] for all given vectors.
+    void multiply_(const std::vector<X*>& out,
+                   const std::vector<X*>& in) const
+    {
+        const std::size_t numRhs = out.size();
+        for (auto row = A_.begin(); row != A_.end(); ++row) {
+            const auto i = row.index();
+            for (std::size_t k = 0; k < numRhs; ++k) {
+                (*out[k])[i] = 0.0;
+            }
+            for (auto col = row->begin(); col != row->end(); ++col) {
+                const auto& block = *col;
+                const auto j = col.index();
+                for (std::size_t k = 0; k < numRhs; ++k) {
+                    block.umv((*in[k])[j], (*out[k])[i]);
+                }
+            }
+        }
+    }
+
+    //! \brief Computes v[k] = (LU)^{-1} d[k] for all given vectors.
+    //! \details Same as Dune::ILU::blockILUBacksolve, for several vectors at once.
+    void precondition_(const std::vector<X*>& v,
+                       const std::vector<const X*>& d) const
+    {
+        using Block = typename X::block_type;
+        const std::size_t numRhs = v.size();
+        std::vector<Block> rhs(numRhs);
+
+        // Lower triangular solve, the diagonal of L is the identity.
+        for (auto row = ILU_.begin(); row != ILU_.end(); ++row) {
+            const auto i = row.index();
+            for (std::size_t k = 0; k < numRhs; ++k) {
+                rhs[k] = (*d[k])[i];
+            }
+            for (auto col = row->begin(); col.index() < i; ++col) {
+                const auto& block = *col;
+                const auto j = col.index();
+                for (std::size_t k = 0; k < numRhs; ++k) {
+                    block.mmv((*v[k])[j], rhs[k]);
+                }
+            }
+            for (std::size_t k = 0; k < numRhs; ++k) {
+                (*v[k])[i] = rhs[k];
+            }
+        }
+
+        // Upper triangular solve, the diagonal blocks hold their inverse.
+        for (auto row = ILU_.beforeEnd(); row != ILU_.beforeBegin(); --row) {
+            const auto i = row.index();
+            for (std::size_t k = 0; k < numRhs; ++k) {
+                rhs[k] = (*v[k])[i];
+            }
+            auto col = row->beforeEnd();
+            for (; col.index() > i; --col) {
+                const auto& block = *col;
+                const auto j = col.index();
+                for (std::size_t k = 0; k < numRhs; ++k) {
+                    block.mmv((*v[k])[j], rhs[k]);
+                }
+            }
+            for (std::size_t k = 0; k < numRhs; ++k) {
+                (*v[k])[i] = 0.0;
+                (*col).umv(rhs[k], (*v[k])[i]);
+            }
+        }
+    }
+
+    const M& A_;
+    M ILU_;
+    field_type reduction_;
+    int maxIter_;
+    double iterations_ = 0.0;
+};
+
+} // namespace Opm
+
+#endif // OPM_MULTI_RHS_BICGSTAB_HEADER_INCLUDED
@@ -20,6 +20,7 @@
 #ifndef OPM_PARALLELOVERLAPPINGILU0_HEADER_INCLUDED
 #define OPM_PARALLELOVERLAPPINGILU0_HEADER_INCLUDED
 #include <opm/common/TimingMacros.hpp>
+#include <opm/grid/utility/SparseTable.hpp>
 #include <opm/simulators/linalg/MILU.hpp>
 #include <opm/simulators/linalg/PreconditionerWithUpdate.hpp>
 #include <dune/istl/paamg/smoother.hh>
@@ -42,7 +43,7 @@ class ParallelOverlappingILU0Args
 {
  public:
     explicit ParallelOverlappingILU0Args(MILU_VARIANT milu = MILU_VARIANT::ILU )
-        : milu_(milu), n_(0)
+        : milu_(milu), n_(0), multithreaded_(false)
     {}
     void setMilu(MILU_VARIANT milu)
     {
@@ -60,9 +61,18 @@ class ParallelOverlappingILU0Args
     {
         return n_;
     }
+    void setMultithreaded(bool multithreaded)
+    {
+        multithreaded_ = multithreaded;
+    }
+    bool getMultithreaded() const
+    {
+        return multithreaded_;
+    }
  private:
     MILU_VARIANT milu_;
     int n_;
+    bool multithreaded_;
 };
 } // end namespace Opm
 
@@ -100,7 +110,9 @@ struct ConstructionTraits<Opm::ParallelOverlappingILU0<Matrix,Domain,Range,Paral
                       args.getComm(),
                       args.getArgs().getN(),
                       args.getArgs().relaxationFactor,
-                      args.getArgs().getMilu()) );
+                      args.getArgs().getMilu(),
+                      false, true,
+                      args.getArgs().getMultithreaded()) );
     }
 };
 
@@ -216,11 +228,14 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param multithreaded Whether to factorize and apply the interior rows
+                           level by level using OpenMP threads.
     */
     ParallelOverlappingILU0 (const Matrix& A,
                              const int n, const field_type w,
                              MILU_VARIANT milu, bool redblack = false,
-                             bool reorder_sphere = true);
+                             bool reorder_sphere = true,
+                             bool multithreaded = false);
 
     /*! \brief Constructor gets all parameters to operate the prec.
       \param A The matrix to operate on.
@@ -233,11 +248,14 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param multithreaded Whether to factorize and apply the interior rows
+                           level by level using OpenMP threads.
     */
     ParallelOverlappingILU0 (const Matrix& A,
                              const ParallelInfo& comm, const int n, const field_type w,
                              MILU_VARIANT milu, bool redblack = false,
-                             bool reorder_sphere = true);
+                             bool reorder_sphere = true,
+                             bool multithreaded = false);
 
     /*! \brief Constructor.
 
@@ -250,11 +268,14 @@ public:
                   The vertices on each layer aound it (same distance) are
                   ordered consecutivly. If false, we preserver the order of
                   the vertices with the same color.
+      \param multithreaded Whether to factorize and apply the interior rows
+                           level by level using OpenMP threads.
     */
     ParallelOverlappingILU0 (const Matrix& A,
                              const field_type w, MILU_VARIANT milu,
                              bool redblack = false,
-                             bool reorder_sphere = true);
+                             bool reorder_sphere = true,
+                             bool multithreaded = false);
 
     /*! \brief Constructor.
 
@@ -268,11 +289,14 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param multithreaded Whether to factorize and apply the interior rows
+                           level by level using OpenMP threads.
     */
     ParallelOverlappingILU0 (const Matrix& A,
                              const ParallelInfo& comm, const field_type w,
                              MILU_VARIANT milu, bool redblack = false,
-                             bool reorder_sphere = true);
+                             bool reorder_sphere = true,
+                             bool multithreaded = false);
 
     /*! \brief Constructor.
 
@@ -287,12 +311,15 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param multithreaded Whether to factorize and apply the interior rows
+                           level by level using OpenMP threads.
     */
     ParallelOverlappingILU0 (const Matrix& A,
                              const ParallelInfo& comm,
                              const field_type w, MILU_VARIANT milu,
                              size_type interiorSize, bool redblack = false,
-                             bool reorder_sphere = true);
+                             bool reorder_sphere = true,
+                             bool multithreaded = false);
 
     /*!
       \brief Prepare the preconditioner.
@@ -331,6 +358,9 @@ protected:
 
     void reorderBack(const Range& reorderedV, Range& v);
 
+    /// \brief Compute the level sets of the lower and upper triangular parts of ILU_.
+    void computeLevels();
+
     //! \brief The ILU0 decomposition of the matrix.
     std::unique_ptr<Matrix> ILU_;
     CRS lower_;
@@ -353,6 +383,12 @@ protected:
     MILU_VARIANT milu_;
     bool redBlack_;
     bool reorderSphere_;
+    //! \brief Whether to process the rows of each level concurrently.
+    bool multithreaded_;
+    //! \brief Interior rows grouped such that each row of the lower (upper)
+    //!        triangular part only depends on rows of earlier levels.
+    Opm::SparseTable<std::size_t> lowerLevels_;
+    Opm::SparseTable<std::size_t> upperLevels_;
 };
 
 } // end namespace Opm
@@ -28,10 +28,19 @@
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/common/TimingMacros.hpp>
 
+#include <opm/grid/utility/SparseTable.hpp>
+
 #include <opm/simulators/linalg/GraphColoring.hpp>
+#include <opm/simulators/linalg/LevelScheduling.hpp>
 #include <opm/simulators/linalg/matrixblock.hh>
 
+#include <algorithm>
 #include <cassert>
+#include <numeric>
+
+#if HAVE_OPENMP
+#include <omp.h>
+#endif
 
 namespace Opm
 {
@@ -42,59 +51,98 @@ namespace detail
 template<class M>
 void ghost_last_bilu0_decomposition (M& A, std::size_t interiorSize)
 {
-    // iterator types
     assert(interiorSize <= A.N());
-    using rowiterator = typename M::RowIterator;
-    using coliterator = typename M::ColIterator;
-    using block = typename M::block_type;
-
-    // implement left looking variant with stored inverse
-    for (rowiterator i = A.begin(); i.index() < interiorSize; ++i)
+    for (std::size_t row = 0; row < interiorSize; ++row)
     {
-        // coliterator is diagonal after the following loop
-        coliterator endij=(*i).end();           // end of row i
-        coliterator ij;
+        bilu0_decompose_row(A, row);
+    }
+}
 
-        // eliminate entries left of diagonal; store L factor
-        for (ij=(*i).begin(); ij.index()<i.index(); ++ij)
+//! Group the first interiorSize rows of A into levels, such that each row
+//! only depends on rows of earlier levels. For the lower levels a row
+//! depends on the rows of its entries left of the diagonal, for the upper
+//! levels on the interior rows of its entries right of the diagonal.
+template<class M>
+Opm::SparseTable<std::size_t> interiorRowLevels(const M& A, std::size_t interiorSize, bool lower)
+{
+    std::vector<std::size_t> level(interiorSize, 0);
+    std::size_t numLevels = 0;
+    const auto setLevel = [&](const std::size_t row)
+    {
+        for (auto col = A[row].begin(), cend = A[row].end(); col != cend; ++col)
         {
-            // find A_jj which eliminates A_ij
-            coliterator jj = A[ij.index()].find(ij.index());
-
-            // compute L_ij = A_jj^-1 * A_ij
-            (*ij).rightmultiply(*jj);
-
-            // modify row
-            coliterator endjk=A[ij.index()].end();    // end of row j
-            coliterator jk=jj; ++jk;
-            coliterator ik=ij; ++ik;
-            while (ik!=endij && jk!=endjk)
-                if (ik.index()==jk.index())
-                {
-                    block B(*jk);
-                    B.leftmultiply(*ij);
-                    *ik -= B;
-                    ++ik; ++jk;
-                }
-                else
-                {
-                    if (ik.index()<jk.index())
-                        ++ik;
-                    else
-                        ++jk;
-                }
+            const std::size_t colIndex = col.index();
+            if (lower ? colIndex < row : (colIndex > row && colIndex < interiorSize))
+            {
+                level[row] = std::max(level[row], level[colIndex] + 1);
+            }
         }
+        numLevels = std::max(numLevels, level[row] + 1);
+    };
 
-        // invert pivot and store it in A
-        if (ij.index()!=i.index())
-            DUNE_THROW(Dune::ISTLError,"diagonal entry missing");
-        try {
-            (*ij).invert();   // compute inverse of diagonal block
-        }
-        catch (Dune::FMatrixError & e) {
-            DUNE_THROW(Dune::ISTLError,"ILU failed to invert matrix block");
-        }
+    if (lower)
+    {
+        for (std::size_t row = 0; row < interiorSize; ++row)
+            setLevel(row);
+    }
+    else
+    {
+        for (std::size_t row = interiorSize; row-- > 0; )
+            setLevel(row);
+    }
+
+    // Sort the rows by level, keeping the order within each level.
+    std::vector<std::size_t> rowsPerLevel(numLevels, 0);
+    for (const auto l : level)
+    {
+        ++rowsPerLevel[l];
+    }
+    std::vector<std::size_t> levelStart(numLevels, 0);
+    std::exclusive_scan(rowsPerLevel.begin(), rowsPerLevel.end(), levelStart.begin(), std::size_t{0});
+    std::vector<std::size_t> rows(interiorSize);
+    for (std::size_t row = 0; row < interiorSize; ++row)
+    {
+        rows[levelStart[level[row]]++] = row;
+    }
+
+    return {rows.data(), rows.data() + rows.size(),
+            rowsPerLevel.data(), rowsPerLevel.data() + rowsPerLevel.size()};
+}
+
+//! Compute the (M)ILU0 decomposition of the interior rows of A, processing
+//! the rows of each level concurrently. The result is the same as the one
+//! of the sequential decomposition.
+template<class M>
+void bilu0_decomposition_by_level(M& A, const Opm::SparseTable<std::size_t>& levels,
+                                  MILU_VARIANT milu)
+{
+    using field_type = typename M::field_type;
+    FieldFunct<M> absF, signF;
+    switch (milu)
+    {
+    case MILU_VARIANT::MILU_1:
+        absF = signFunctor<field_type>;
+        signF = oneFunctor<field_type>;
+        break;
+    case MILU_VARIANT::MILU_2:
+        absF = identityFunctor<field_type>;
+        signF = signFunctor<field_type>;
+        break;
+    case MILU_VARIANT::MILU_3:
+        absF = absFunctor<field_type>;
+        signF = signFunctor<field_type>;
+        break;
+    case MILU_VARIANT::MILU_4:
+        absF = identityFunctor<field_type>;
+        signF = isPositiveFunctor<field_type>;
+        break;
+    default:
+        forEachRowByLevel(levels, [&A](const std::size_t row) { bilu0_decompose_row(A, row); });
+        return;
     }
+
+    forEachRowByLevel(levels, [&](const std::size_t row)
+                      { milu0_decompose_row(A, row, absF, signF); });
 }
 
 //! compute ILU decomposition of A. A is overwritten by its decomposition
@@ -188,6 +236,16 @@ void convertToCRS(const M& A, CRS& lower, CRS& upper, InvVector& inv)
   assert(colcount == numUpper);
 }
 
+//! Whether to use level scheduled multithreading, if requested.
+inline bool useMultithreading([[maybe_unused]] bool requested)
+{
+#if HAVE_OPENMP
+    return requested && omp_get_max_threads() > 1;
+#else
+    return false;
+#endif
+}
+
 template <class PI>
 size_t set_interiorSize( [[maybe_unused]] size_t N, size_t interiorSize, [[maybe_unused]] const PI& comm)
 {
@@ -233,14 +291,15 @@ ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
 ParallelOverlappingILU0(const Matrix& A,
                         const int n, const field_type w,
                         MILU_VARIANT milu, bool redblack,
-                        bool reorder_sphere)
+                        bool reorder_sphere, bool multithreaded)
     : lower_(),
       upper_(),
       inv_(),
       comm_(nullptr), w_(w),
       relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
       A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(n),
-      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+      multithreaded_(detail::useMultithreading(multithreaded))
 {
     interiorSize_ = A.N();
     // BlockMatrix is a Subclass of FieldMatrix that just adds
@@ -253,14 +312,15 @@ ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
 ParallelOverlappingILU0(const Matrix& A,
                         const ParallelInfo& comm, const int n, const field_type w,
                         MILU_VARIANT milu, bool redblack,
-                        bool reorder_sphere)
+                        bool reorder_sphere, bool multithreaded)
     : lower_(),
       upper_(),
       inv_(),
       comm_(&comm), w_(w),
       relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
       A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(n),
-      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+      multithreaded_(detail::useMultithreading(multithreaded))
 {
     interiorSize_ = A.N();
     // BlockMatrix is a Subclass of FieldMatrix that just adds
@@ -272,8 +332,8 @@ template<class Matrix, class Domain, class Range, class ParallelInfoT>
 ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
 ParallelOverlappingILU0(const Matrix& A,
                         const field_type w, MILU_VARIANT milu, bool redblack,
-                        bool reorder_sphere)
-    : ParallelOverlappingILU0( A, 0, w, milu, redblack, reorder_sphere )
+                        bool reorder_sphere, bool multithreaded)
+    : ParallelOverlappingILU0( A, 0, w, milu, redblack, reorder_sphere, multithreaded )
 {}
 
 template<class Matrix, class Domain, class Range, class ParallelInfoT>
@@ -281,14 +341,15 @@ ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
 ParallelOverlappingILU0(const Matrix& A,
                         const ParallelInfo& comm, const field_type w,
                         MILU_VARIANT milu, bool redblack,
-                        bool reorder_sphere)
+                        bool reorder_sphere, bool multithreaded)
     : lower_(),
       upper_(),
       inv_(),
       comm_(&comm), w_(w),
       relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
       A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(0),
-      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+      multithreaded_(detail::useMultithreading(multithreaded))
 {
     interiorSize_ = A.N();
     // BlockMatrix is a Subclass of FieldMatrix that just adds
@@ -302,7 +363,7 @@ ParallelOverlappingILU0(const Matrix& A,
                         const ParallelInfo& comm,
                         const field_type w, MILU_VARIANT milu,
                         size_type interiorSize, bool redblack,
-                        bool reorder_sphere)
+                        bool reorder_sphere, bool multithreaded)
     : lower_(),
       upper_(),
       inv_(),
@@ -310,7 +371,8 @@ ParallelOverlappingILU0(const Matrix& A,
       relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
       interiorSize_(interiorSize),
       A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(0),
-      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+      multithreaded_(detail::useMultithreading(multithreaded))
 {
     // BlockMatrix is a Subclass of FieldMatrix that just adds
     // methods. Therefore this cast should be safe.
@@ -340,7 +402,7 @@ apply (Domain& v, const Range& d)
     }
 
     // lower triangular solve
-    for (size_type i = 0; i < lowerLoopEnd; ++i)
+    const auto lowerSolveRow = [&](const size_type i)
     {
         dblock rhs( md[ i ] );
         const size_type rowI     = lower_.rows_[ i ];
@@ -352,9 +414,10 @@ apply (Domain& v, const Range& d)
         }
 
         mv[ i ] = rhs;  // Lii = I
-    }
+    };
 
-    for (size_type i = upperLoopStart; i < iEnd; ++i)
+    // upper triangular solve, upper_ and inv_ are stored in reverse row order
+    const auto upperSolveRow = [&](const size_type i)
     {
         vblock& vBlock = mv[ lastRow - i ];
         vblock rhs ( vBlock );
@@ -368,6 +431,25 @@ apply (Domain& v, const Range& d)
 
         // apply inverse and store result
         inv_[ i ].mv( rhs, vBlock);
+    };
+
+    if (multithreaded_)
+    {
+        detail::forEachRowByLevel(lowerLevels_, lowerSolveRow);
+        detail::forEachRowByLevel(upperLevels_, [&](const size_type row)
+                                  { upperSolveRow(lastRow - row); });
+    }
+    else
+    {
+        for (size_type i = 0; i < lowerLoopEnd; ++i)
+        {
+            lowerSolveRow(i);
+        }
+
+        for (size_type i = upperLoopStart; i < iEnd; ++i)
+        {
+            upperSolveRow(i);
+        }
     }
 
     copyOwnerToAll( mv );
@@ -440,6 +522,8 @@ update()
         inverseOrdering[newIndex] = index++;
     }
 
+    // Whether the sparsity pattern of ILU_ changed.
+    bool newPattern = true;
     try
     {
         OPM_TIMEBLOCK(iluDecomposition);
@@ -455,6 +539,7 @@ update()
             {
                 if (ILU_) {
                     OPM_TIMEBLOCK(iluDecompositionMakeMatrix);
+                    newPattern = false;
                     // The ILU_ matrix is already a copy with the same
                     // sparse structure as A_, but the values of A_ may
                     // have changed, so we must copy all elements.
@@ -497,29 +582,40 @@ update()
                 }
             }
 
-            switch (milu_)
+            if (multithreaded_)
             {
-            case MILU_VARIANT::MILU_1:
-                detail::milu0_decomposition ( *ILU_);
-                break;
-            case MILU_VARIANT::MILU_2:
-                detail::milu0_decomposition ( *ILU_, detail::identityFunctor<typename Matrix::field_type>,
-                                              detail::signFunctor<typename Matrix::field_type> );
-                break;
-            case MILU_VARIANT::MILU_3:
-                detail::milu0_decomposition ( *ILU_, detail::absFunctor<typename Matrix::field_type>,
-                                              detail::signFunctor<typename Matrix::field_type> );
-                break;
-            case MILU_VARIANT::MILU_4:
-                detail::milu0_decomposition ( *ILU_, detail::identityFunctor<typename Matrix::field_type>,
-                                              detail::isPositiveFunctor<typename Matrix::field_type> );
-                break;
-            default:
-                if (interiorSize_ == A_->N())
-                    Dune::ILU::blockILU0Decomposition( *ILU_ );
-                else
-                    detail::ghost_last_bilu0_decomposition(*ILU_, interiorSize_);
-                break;
+                if (newPattern)
+                {
+                    computeLevels();
+                }
+                detail::bilu0_decomposition_by_level(*ILU_, lowerLevels_, milu_);
+            }
+            else
+            {
+                switch (milu_)
+                {
+                case MILU_VARIANT::MILU_1:
+                    detail::milu0_decomposition ( *ILU_);
+                    break;
+                case MILU_VARIANT::MILU_2:
+                    detail::milu0_decomposition ( *ILU_, detail::identityFunctor<typename Matrix::field_type>,
+                                                  detail::signFunctor<typename Matrix::field_type> );
+                    break;
+                case MILU_VARIANT::MILU_3:
+                    detail::milu0_decomposition ( *ILU_, detail::absFunctor<typename Matrix::field_type>,
+                                                  detail::signFunctor<typename Matrix::field_type> );
+                    break;
+                case MILU_VARIANT::MILU_4:
+                    detail::milu0_decomposition ( *ILU_, detail::identityFunctor<typename Matrix::field_type>,
+                                                  detail::isPositiveFunctor<typename Matrix::field_type> );
+                    break;
+                default:
+                    if (interiorSize_ == A_->N())
+                        Dune::ILU::blockILU0Decomposition( *ILU_ );
+                    else
+                        detail::ghost_last_bilu0_decomposition(*ILU_, interiorSize_);
+                    break;
+                }
             }
         }
         else {
@@ -538,6 +634,10 @@ update()
             }
 
             milun_decomposition( *A_, iluIteration_, milu_, *ILU_, *reorderer, *inverseReorderer );
+            if (multithreaded_)
+            {
+                computeLevels();
+            }
         }
     }
     catch (const Dune::MatrixBlockError& error)
@@ -561,6 +661,15 @@ update()
     detail::convertToCRS(*ILU_, lower_, upper_, inv_);
 }
 
+template<class Matrix, class Domain, class Range, class ParallelInfoT>
+void ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
+computeLevels()
+{
+    OPM_TIMEBLOCK(computeLevels);
+    lowerLevels_ = detail::interiorRowLevels(*ILU_, interiorSize_, true);
+    upperLevels_ = detail::interiorRowLevels(*ILU_, interiorSize_, false);
+}
+
 template<class Matrix, class Domain, class Range, class ParallelInfoT>
 Range& ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
 reorderD(const Range& d)
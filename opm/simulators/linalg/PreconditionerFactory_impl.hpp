@@ -25,6 +25,8 @@
 
 #include <opm/simulators/linalg/PreconditionerFactory.hpp>
 
+#include <opm/simulators/linalg/BISAI.hpp>
+#include <opm/simulators/linalg/ChowPatelILU.hpp>
 #include <opm/simulators/linalg/DILU.hpp>
 #include <opm/simulators/linalg/ExtraSmoothers.hpp>
 #include <opm/simulators/linalg/FlexibleSolver.hpp>
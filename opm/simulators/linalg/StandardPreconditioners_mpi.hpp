@@ -29,6 +29,8 @@
 #endif
 #endif
 
+#include <opm/simulators/linalg/TrivialPreconditioner.hpp>
+
 #include <functional>
 #include <memory>
 #include <type_traits>
@@ -65,6 +67,7 @@ struct AMGSmootherArgsHelper<ParallelOverlappingILU0<M, V, V, C>>
         smootherArgs.setN(iluwitdh);
         const MILU_VARIANT milu = convertString2Milu(prm.get<std::string>("milutype", std::string("ilu")));
         smootherArgs.setMilu(milu);
+        smootherArgs.setMultithreaded(prm.get<bool>("multithreaded", false));
         // smootherArgs.overlap=SmootherArgs::vertex;
         // smootherArgs.overlap=SmootherArgs::none;
         // smootherArgs.overlap=SmootherArgs::aggregate;
@@ -163,6 +166,20 @@ struct StandardPreconditioners
             DUNE_UNUSED_PARAMETER(prm);
             return wrapBlockPreconditioner<MultithreadDILU<M, V, V>>(comm, op.getmat());
         });
+        F::addCreator("chowpatelilu", [](const O& op, const P& prm, const std::function<V()>&, std::size_t, const C& comm) {
+            const int sweeps = prm.get<int>("sweeps", 6);
+            return wrapBlockPreconditioner<ChowPatelILU<M, V, V>>(comm, op.getmat(), sweeps);
+        });
+        F::addCreator("bisai", [](const O& op, const P& prm, const std::function<V()>&, std::size_t, const C& comm) {
+            const double w = prm.get<double>("relaxation", 1.0);
+            return wrapBlockPreconditioner<BISAI<M, V, V>>(comm, op.getmat(), w);
+        });
+        F::addCreator("mixed-ilu0", [](const O&, const P&, const std::function<V()>&, std::size_t, const C&) {
+            return std::make_shared<TrivialPreconditioner<V,V>>();
+        });
+        F::addCreator("mixed-dilu", [](const O&, const P&, const std::function<V()>&, std::size_t, const C&) {
+            return std::make_shared<TrivialPreconditioner<V,V>>();
+        });
         F::addCreator("jac", [](const O& op, const P& prm, const std::function<V()>&, std::size_t, const C& comm) {
             const int n = prm.get<int>("repeats", 1);
             const double w = prm.get<double>("relaxation", 1.0);
@@ -408,15 +425,18 @@ struct StandardPreconditioners
         const double w = prm.get<double>("relaxation", 1.0);
         const bool redblack = prm.get<bool>("redblack", false);
         const bool reorder_spheres = prm.get<bool>("reorder_spheres", false);
+        const bool multithreaded = prm.get<bool>("multithreaded", false);
         // Already a parallel preconditioner. Need to pass comm, but no need to wrap it in a BlockPreconditioner.
         if (ilulevel == 0) {
             const std::size_t num_interior = interiorIfGhostLast(comm);
             assert(num_interior <= op.getmat().N());
             return std::make_shared<ParallelOverlappingILU0<M, V, V, Comm>>(
-                op.getmat(), comm, w, MILU_VARIANT::ILU, num_interior, redblack, reorder_spheres);
+                op.getmat(), comm, w, MILU_VARIANT::ILU, num_interior, redblack, reorder_spheres,
+                multithreaded);
         } else {
             return std::make_shared<ParallelOverlappingILU0<M, V, V, Comm>>(
-                op.getmat(), comm, ilulevel, w, MILU_VARIANT::ILU, redblack, reorder_spheres);
+                op.getmat(), comm, ilulevel, w, MILU_VARIANT::ILU, redblack, reorder_spheres,
+                multithreaded);
         }
     }
 
@@ -29,26 +29,14 @@
 #endif
 #endif
 
+#include <opm/simulators/linalg/TrivialPreconditioner.hpp>
+
 #include <functional>
 #include <memory>
 #include <type_traits>
 
 namespace Opm {
 
-template <class X, class Y>
-class TrivialPreconditioner : public Dune::PreconditionerWithUpdate<X, Y>
-{
-    public:
-    TrivialPreconditioner(){};
-    virtual void update() override {};
-    virtual bool hasPerfectUpdate() const override {return true;}
-    virtual void pre ([[maybe_unused]] X& x, [[maybe_unused]] Y& y) override {};
-    virtual void post ([[maybe_unused]] X& x) override {};
-    virtual void apply ([[maybe_unused]] X& x, [[maybe_unused]] const Y& y) override {};
-    virtual Dune::SolverCategory::Category category() const override { return Dune::SolverCategory::sequential; };
-};
-
-
 template <class Operator>
 struct StandardPreconditioners<Operator, Dune::Amg::SequentialInformation, typename std::enable_if_t<!Opm::is_gpu_operator_v<Operator>>>
 {
@@ -63,8 +51,9 @@ struct StandardPreconditioners<Operator, Dune::Amg::SequentialInformation, typen
         using P = PropertyTree;
         F::addCreator("ilu0", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             const double w = prm.get<double>("relaxation", 1.0);
+            const bool multithreaded = prm.get<bool>("multithreaded", false);
             return std::make_shared<ParallelOverlappingILU0<M, V, V, C>>(
-                op.getmat(), 0, w, MILU_VARIANT::ILU);
+                op.getmat(), 0, w, MILU_VARIANT::ILU, false, true, multithreaded);
         });
         F::addCreator("duneilu", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             const double w = prm.get<double>("relaxation", 1.0);
@@ -75,19 +64,29 @@ struct StandardPreconditioners<Operator, Dune::Amg::SequentialInformation, typen
         F::addCreator("paroverilu0", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             const double w = prm.get<double>("relaxation", 1.0);
             const int n = prm.get<int>("ilulevel", 0);
+            const bool multithreaded = prm.get<bool>("multithreaded", false);
             return std::make_shared<ParallelOverlappingILU0<M, V, V, C>>(
-                op.getmat(), n, w, MILU_VARIANT::ILU);
+                op.getmat(), n, w, MILU_VARIANT::ILU, false, true, multithreaded);
         });
         F::addCreator("ilun", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             const int n = prm.get<int>("ilulevel", 0);
             const double w = prm.get<double>("relaxation", 1.0);
+            const bool multithreaded = prm.get<bool>("multithreaded", false);
             return std::make_shared<ParallelOverlappingILU0<M, V, V, C>>(
-                op.getmat(), n, w, MILU_VARIANT::ILU);
+                op.getmat(), n, w, MILU_VARIANT::ILU, false, true, multithreaded);
         });
         F::addCreator("dilu", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             DUNE_UNUSED_PARAMETER(prm);
             return std::make_shared<MultithreadDILU<M, V, V>>(op.getmat());
         });
+        F::addCreator("chowpatelilu", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
+            const int sweeps = prm.get<int>("sweeps", 6);
+            return std::make_shared<ChowPatelILU<M, V, V>>(op.getmat(), sweeps);
+        });
+        F::addCreator("bisai", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
+            const double w = prm.get<double>("relaxation", 1.0);
+            return std::make_shared<BISAI<M, V, V>>(op.getmat(), w);
+        });
         F::addCreator("mixed-ilu0", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             DUNE_UNUSED_PARAMETER(prm);
             DUNE_UNUSED_PARAMETER(op);
@@ -0,0 +1,45 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_TRIVIALPRECONDITIONER_HEADER_INCLUDED
+#define OPM_TRIVIALPRECONDITIONER_HEADER_INCLUDED
+
+#include <dune/istl/solvercategory.hh>
+
+#include <opm/simulators/linalg/PreconditionerWithUpdate.hpp>
+
+namespace Opm {
+
+// Placeholder for the mixed-precision solvers, which do their own preconditioning.
+template <class X, class Y>
+class TrivialPreconditioner : public Dune::PreconditionerWithUpdate<X, Y>
+{
+    public:
+    TrivialPreconditioner(){};
+    virtual void update() override {};
+    virtual bool hasPerfectUpdate() const override {return true;}
+    virtual void pre ([[maybe_unused]] X& x, [[maybe_unused]] Y& y) override {};
+    virtual void post ([[maybe_unused]] X& x) override {};
+    virtual void apply ([[maybe_unused]] X& x, [[maybe_unused]] const Y& y) override {};
+    virtual Dune::SolverCategory::Category category() const override { return Dune::SolverCategory::sequential; };
+};
+
+} // namespace Opm
+
+#endif // OPM_TRIVIALPRECONDITIONER_HEADER_INCLUDED
@@ -33,6 +33,11 @@
 #include <dune/istl/paamg/smoother.hh>
 
 #include <cstddef>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace Opm {
 
@@ -84,6 +89,10 @@ public:
     void apply(const X& x, Y& y) const override
     {
         OPM_TIMEBLOCK(apply);
+        if (this->wellMod_.useThreadedWells()) {
+            this->applyThreaded(x, y);
+            return;
+        }
         for (const auto& well : this->wellMod_) {
             this->applySingleWell(x, y, well, well->cells());
         }
@@ -144,23 +153,73 @@ protected:
     void applySingleWell(const X& x, Y& y,
                          const WellType& well,
                          const ArrayType& cells) const
+    {
+        this->applySingleWell(x, y, well, cells, x_local_, Ax_local_);
+    }
+
+    template<class WellType, class ArrayType>
+    void applySingleWell(const X& x, Y& y,
+                         const WellType& well,
+                         const ArrayType& cells,
+                         X& x_local,
+                         Y& Ax_local) const
     {
         // Well equations B and C uses only the perforated cells, so need to apply on local vectors
-        x_local_.resize(cells.size());
-        Ax_local_.resize(cells.size());
+        x_local.resize(cells.size());
+        Ax_local.resize(cells.size());
 
         for (size_t i = 0; i < cells.size(); ++i) {
-            x_local_[i] = x[cells[i]];
-            Ax_local_[i] = y[cells[i]];
+            x_local[i] = x[cells[i]];
+            Ax_local[i] = y[cells[i]];
         }
 
-        well->apply(x_local_, Ax_local_);
+        well->apply(x_local, Ax_local);
 
         for (size_t i = 0; i < cells.size(); ++i) {
             // only need to update Ax
-            y[cells[i]] = Ax_local_[i];
+            y[cells[i]] = Ax_local[i];
+        }
+
+    }
+
+    //! Apply the groups of wells without shared cells one after another,
+    //! with the wells of a group applied concurrently. Each entry of y is
+    //! thereby written by at most one thread at a time.
+    void applyThreaded(const X& x, Y& y) const
+    {
+        OPM_TIMEBLOCK(applyThreaded);
+        const auto& wells = this->wellMod_.localNonshutWells();
+#ifdef _OPENMP
+        const std::size_t num_threads = omp_get_max_threads();
+#else
+        const std::size_t num_threads = 1;
+#endif
+        if (thread_x_local_.size() < num_threads) {
+            thread_x_local_.resize(num_threads);
+            thread_Ax_local_.resize(num_threads);
+        }
+
+        for (const auto& group : this->wellMod_.threadedWellGroups()) {
+            const int num_group_wells = group.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+            for (int i = 0; i < num_group_wells; ++i) {
+#ifdef _OPENMP
+                const int thread = omp_get_thread_num();
+#else
+                const int thread = 0;
+#endif
+                const auto& well = wells[group[i]];
+                this->applySingleWell(x, y, well, well->cells(),
+                                      thread_x_local_[thread], thread_Ax_local_[thread]);
+            }
         }
 
+        // Distributed wells communicate in apply().
+        for (const int w : this->wellMod_.serialWells()) {
+            this->applySingleWell(x, y, wells[w], wells[w]->cells());
+        }
     }
 
     // These members are used to avoid reallocation.
@@ -169,6 +228,9 @@ protected:
     mutable X x_local_{};
     mutable Y Ax_local_{};
     mutable Y scaleAddRes_{};
+    // Per-thread local vectors for applyThreaded().
+    mutable std::vector<X> thread_x_local_{};
+    mutable std::vector<Y> thread_Ax_local_{};
 };
 
 template <class WellModel, class X, class Y>
@@ -111,6 +111,16 @@ namespace Details
     }
 
 
+    template <class Vector>
+    void extractVector(const Vector& x, const std::vector<int>& indices, Vector& res)
+    {
+        assert(res.size() == indices.size());
+        for (std::size_t ii = 0; ii < indices.size(); ++ii) {
+            res[ii] = x[indices[ii]];
+        }
+    }
+
+
     template <class Vector>
     void setGlobal(const Vector& x, const std::vector<int>& indices, Vector& global_x)
     {
@@ -13,6 +13,12 @@ bslv_memory *bslv_alloc()
     assert(mem);
     mem->e    = NULL;
     mem->dtmp = NULL;
+    mem->P    = NULL;
+
+    mem->comm.ctx       = NULL;
+    mem->comm.allreduce = NULL;
+    mem->comm.exchange  = NULL;
+    mem->comm.mask      = NULL;
     return mem;
 }
 
@@ -53,8 +59,9 @@ void bslv_init(bslv_memory *mem, double tol, int max_iter, bsr_matrix const *A,
     mem->max_iter = max_iter;
     mem->n = n;
 
-    mem->e = (double*) malloc(max_iter*sizeof(double));
+    mem->e = (double*) malloc((max_iter+1)*sizeof(double));
     assert(mem->e);
+    mem->e[0] = 1.0;
 
     int narrays=7;
     mem->dtmp = (double**) malloc(narrays*sizeof(double*));
@@ -72,6 +79,17 @@ void bslv_init(bslv_memory *mem, double tol, int max_iter, bsr_matrix const *A,
     prec_init(mem->P, A); // initialize structure of L,D,U components of P
 }
 
+void bslv_set_comm(bslv_memory *mem, void *ctx,
+                   void (*allreduce)(void *ctx, double *values, int count),
+                   void (*exchange)(void *ctx, double *x),
+                   const double *mask)
+{
+    mem->comm.ctx       = ctx;
+    mem->comm.allreduce = allreduce;
+    mem->comm.exchange  = exchange;
+    mem->comm.mask      = mask;
+}
+
 /**
  * @brief Inner product of two vectors.
  *
@@ -90,6 +108,9 @@ double __attribute__((noinline)) vec_inner2(const double *a, const double *b, in
     int const N=8;
     double agg[N];
     for(int i=0;i<N;i++) agg[i]=0.0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:agg[:N])
+#endif
     for(int i=0;i<n;i+=N)
     {
         for(int j=0;j<N;j++) agg[j]+=x[i+j]*y[i+j];
@@ -101,79 +122,63 @@ double __attribute__((noinline)) vec_inner2(const double *a, const double *b, in
     return agg[0];
 }
 
-int bslv_pbicgstab3m(bslv_memory *mem, bsr_matrix *A, const double *b, double *x)
+/**
+ * @brief Sum partial results over all processes.
+ *
+ * @param mem Pointer to solver memory object.
+ * @param values Pointer to partial results.
+ * @param count Number of values.
+ */
+static inline void bslv_allreduce(bslv_memory *mem, double *values, int count)
 {
+    if(mem->comm.allreduce) mem->comm.allreduce(mem->comm.ctx, values, count);
+}
 
-    double tol = mem->tol;
-    int max_iter = mem->max_iter;
-    int n = mem->n;
-
-    double * restrict e = mem->e;
-    const double *r0 = b;
-    //const double * restrict r0  = mem->dtmp[0]; //access randomly initialized one-dimensional shadow space
-    double * restrict p_j = mem->dtmp[1];
-    double * restrict q_j = mem->dtmp[2];
-    double * restrict r_j = mem->dtmp[3];
-    double * restrict s_j = mem->dtmp[4];
-    double * restrict t_j = mem->dtmp[5];
-    double * restrict v_j = mem->dtmp[6];
-    double * restrict x_j = x;
-
-    prec_t * restrict P = mem->P;
-    mem->use_dilu ? prec_dilu_factorize(P,A) : prec_ilu0_factorize(P,A); // choose dilu or ilu0
-    prec_downcast(P);
-
-    vec_fill(x_j,0.0,n);
-    vec_copy(r_j,b,n);
-    vec_copy(p_j,b,n);
-
-    vec_copy(q_j,p_j,n);
-    //double norm_0 = sqrt(vec_inner(r_j,r_j,n));
-    double norm_0 = sqrt(vec_inner2(r_j,r_j,n));
-
-    //double rho_j = vec_inner(r0,r_j,n);
-    double rho_j = vec_inner2(r0,r_j,n);
-    int j;
-    for(j=0;j<max_iter;j++)
-    {
-        //vec_copy(q_j,p_j,n);                                        //q_j=p_j
-        prec_mapply3c(P,q_j);                                          //q_j=P.q_j;
-        bsr_vmspmv3(A,q_j,v_j);                                        //v_j= A.q_j
-
-        //double alpha_j = rho_j/vec_inner(r0,v_j,n);
-        double alpha_j = rho_j/vec_inner2(r0,v_j,n);
-        for (int k=0;k<n;k++) q_j[k] = s_j[k] = r_j[k]-alpha_j*v_j[k];       // r_j and s_j can overwrite each other
-        //vec_axpy(-alpha_j,v_j,r_j,s_j,n);
-
-        //vec_copy(q_j,s_j,n);                                        //q_j=s_j
-        prec_mapply3c(P,q_j);                                          //q_j=P.q_j;
-        bsr_vmspmv3(A,q_j,t_j);                                        //t_j= A.q_j
-
-        //double w_j = vec_inner(s_j,t_j,n)/vec_inner(t_j,t_j,n);
-        double w_j = vec_inner2(s_j,t_j,n)/vec_inner2(t_j,t_j,n);
-        for (int k=0;k<n;k++) x_j[k] += alpha_j*p_j[k] + w_j*s_j[k];
-        for (int k=0;k<n;k++) r_j[k]  =         s_j[k] - w_j*t_j[k];
-        //vec_axpy(-w_j,t_j,s_j,r_j,n);
-        //double norm_e = sqrt(vec_inner(r_j,r_j,n));
-        double norm_e = sqrt(vec_inner2(r_j,r_j,n));
-        e[j+1]=norm_e/norm_0;
-
-        if (norm_e<tol*norm_0) break;                               //convergence check
-
-        double rho_0 =rho_j;
-        //rho_j=vec_inner(r0,r_j,n);
-        rho_j=vec_inner2(r0,r_j,n);
-
-        double beta_j = (alpha_j/w_j)*(rho_j/rho_0);
-        for (int k=0;k<n;k++) q_j[k] = p_j[k] = r_j[k] + beta_j*(p_j[k] - w_j*v_j[k]);
-    }
-    prec_mapply3c(P,x_j);                                       //x_j=P.x_j;
-
-    return j == max_iter ? j : ++j;
+/**
+ * @brief Zero out entries not owned by this process.
+ *
+ * @param mem Pointer to solver memory object.
+ * @param x Pointer to vector.
+ * @param n Vector length.
+ */
+static inline void bslv_project(bslv_memory *mem, double *x, int n)
+{
+    const double *mask = mem->comm.mask;
+    if(mask==NULL) return;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int k=0;k<n;k++) x[k]*=mask[k];
 }
 
+/**
+ * @brief Apply preconditioner and make result consistent across processes.
+ *
+ * @param mem Pointer to solver memory object.
+ * @param x Pointer to input/output vector.
+ * @param mixed Use single-precision (true) or double-precision (false) factors.
+ */
+static inline void bslv_precondition(bslv_memory *mem, double *x, bool mixed)
+{
+    mixed ? prec_mapply(mem->P,x) : prec_dapply(mem->P,x);
+    if(mem->comm.exchange) mem->comm.exchange(mem->comm.ctx, x);
+}
 
-int bslv_pbicgstab3d(bslv_memory *mem, bsr_matrix *A, const double *b, double *x)
+/**
+ * @brief Preconditioned bicgstab.
+ *
+ * @note Inner products computed at the same point of the algorithm are
+ *       summed over all processes in a single reduction.
+ *
+ * @param mem Pointer to solver memory object.
+ * @param A Pointer to coeffient matrix in bsr format
+ * @param b Pointer to right-hand side vector
+ * @apram x Pointer to solution vector
+ * @param mixed Use mixed-precision (true) or double-precision (false).
+ *
+ * @return Number of linear iterations.
+ */
+static int bslv_pbicgstab(bslv_memory *mem, bsr_matrix *A, const double *b, double *x, bool mixed)
 {
 
     double tol = mem->tol;
@@ -181,8 +186,7 @@ int bslv_pbicgstab3d(bslv_memory *mem, bsr_matrix *A, const double *b, double *x
     int n = mem->n;
 
     double * restrict e = mem->e;
-    const double *r0 = b;
-    //const double * restrict r0  = mem->dtmp[0]; //access randomly initialized one-dimensional shadow space
+    double * restrict r0  = mem->dtmp[0]; // padded copy of right-hand side
     double * restrict p_j = mem->dtmp[1];
     double * restrict q_j = mem->dtmp[2];
     double * restrict r_j = mem->dtmp[3];
@@ -196,56 +200,79 @@ int bslv_pbicgstab3d(bslv_memory *mem, bsr_matrix *A, const double *b, double *x
     prec_downcast(P);
 
     vec_fill(x_j,0.0,n);
-    vec_copy(r_j,b,n);
-    vec_copy(p_j,b,n);
+    vec_copy(r0,b,n);
+    bslv_project(mem,r0,n);                                            // owner entries only
+    vec_copy(r_j,r0,n);
+    vec_copy(p_j,r0,n);
 
     vec_copy(q_j,p_j,n);
-    //double norm_0 = sqrt(vec_inner(r_j,r_j,n));
-    double norm_0 = sqrt(vec_inner2(r_j,r_j,n));
-
-    //double rho_j = vec_inner(r0,r_j,n);
-    double rho_j = vec_inner2(r0,r_j,n);
+    double dots[2];
+    dots[0] = vec_inner2(r_j,r_j,n);
+    dots[1] = vec_inner2(r0,r_j,n);
+    bslv_allreduce(mem,dots,2);
+    double norm_0 = sqrt(dots[0]);
+    double rho_j = dots[1];
     int j;
     for(j=0;j<max_iter;j++)
     {
-        //vec_copy(q_j,p_j,n);                                        //q_j=p_j
-        prec_dapply3c(P,q_j);                                          //q_j=P.q_j;
-        bsr_vdspmv3(A,q_j,v_j);                                        //v_j= A.q_j
-
-        //double alpha_j = rho_j/vec_inner(r0,v_j,n);
-        double alpha_j = rho_j/vec_inner2(r0,v_j,n);
+        bslv_precondition(mem,q_j,mixed);                              //q_j=P.q_j;
+        mixed ? bsr_vmspmv(A,q_j,v_j) : bsr_vdspmv(A,q_j,v_j);        //v_j= A.q_j
+        bslv_project(mem,v_j,n);
+
+        dots[0] = vec_inner2(r0,v_j,n);
+        bslv_allreduce(mem,dots,1);
+        double alpha_j = rho_j/dots[0];
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for (int k=0;k<n;k++) q_j[k] = s_j[k] = r_j[k]-alpha_j*v_j[k];       // r_j and s_j can overwrite each other
-        //vec_axpy(-alpha_j,v_j,r_j,s_j,n);
-
-        //vec_copy(q_j,s_j,n);                                        //q_j=s_j
-        prec_dapply3c(P,q_j);                                          //q_j=P.q_j;
-        bsr_vdspmv3(A,q_j,t_j);                                        //t_j= A.q_j
-
-        //double w_j = vec_inner(s_j,t_j,n)/vec_inner(t_j,t_j,n);
-        double w_j = vec_inner2(s_j,t_j,n)/vec_inner2(t_j,t_j,n);
-        for (int k=0;k<n;k++) x_j[k] += alpha_j*p_j[k] + w_j*s_j[k];
-        for (int k=0;k<n;k++) r_j[k]  =         s_j[k] - w_j*t_j[k];
-        //vec_axpy(-w_j,t_j,s_j,r_j,n);
-        //double norm_e = sqrt(vec_inner(r_j,r_j,n));
-        double norm_e = sqrt(vec_inner2(r_j,r_j,n));
+
+        bslv_precondition(mem,q_j,mixed);                              //q_j=P.q_j;
+        mixed ? bsr_vmspmv(A,q_j,t_j) : bsr_vdspmv(A,q_j,t_j);        //t_j= A.q_j
+        bslv_project(mem,t_j,n);
+
+        dots[0] = vec_inner2(s_j,t_j,n);
+        dots[1] = vec_inner2(t_j,t_j,n);
+        bslv_allreduce(mem,dots,2);
+        double w_j = dots[0]/dots[1];
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int k=0;k<n;k++)
+        {
+            x_j[k] += alpha_j*p_j[k] + w_j*s_j[k];
+            r_j[k]  =         s_j[k] - w_j*t_j[k];
+        }
+
+        // residual norm and next rho in one reduction
+        dots[0] = vec_inner2(r_j,r_j,n);
+        dots[1] = vec_inner2(r0,r_j,n);
+        bslv_allreduce(mem,dots,2);
+        double norm_e = sqrt(dots[0]);
         e[j+1]=norm_e/norm_0;
 
         if (norm_e<tol*norm_0) break;                               //convergence check
 
         double rho_0 =rho_j;
-        //rho_j=vec_inner(r0,r_j,n);
-        rho_j=vec_inner2(r0,r_j,n);
+        rho_j=dots[1];
 
         double beta_j = (alpha_j/w_j)*(rho_j/rho_0);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for (int k=0;k<n;k++) q_j[k] = p_j[k] = r_j[k] + beta_j*(p_j[k] - w_j*v_j[k]);
     }
-    prec_dapply3c(P,x_j);                                       //x_j=P.x_j;
+    bslv_precondition(mem,x_j,mixed);                               //x_j=P.x_j;
 
     return j == max_iter ? j : ++j;
 }
 
+int bslv_pbicgstabm(bslv_memory *mem, bsr_matrix *A, const double *b, double *x)
+{
+    return bslv_pbicgstab(mem,A,b,x,true);
+}
 
-
-
-
-
+int bslv_pbicgstabd(bslv_memory *mem, bsr_matrix *A, const double *b, double *x)
+{
+    return bslv_pbicgstab(mem,A,b,x,false);
+}
@@ -10,6 +10,23 @@ extern "C" {
 
 #include <stdbool.h>
 
+/*!
+ * @brief Communication callbacks for parallel runs.
+ */
+typedef
+struct bslv_comm
+{
+    // opaque pointer passed to callbacks
+    void *ctx;
+    // sum count values over all processes in-place
+    void (*allreduce)(void *ctx, double *values, int count);
+    // copy owner entries of x to overlap entries on all processes
+    void (*exchange)(void *ctx, double *x);
+    // one for owner entries and zero otherwise
+    const double *mask;
+}
+bslv_comm;
+
 /*!
  * @brief Linear solver memory.
  */
@@ -33,6 +50,9 @@ struct bslv_memory
 
     // pointer to preconditioner
     prec_t *P;
+
+    // communication callbacks (all NULL in serial runs)
+    bslv_comm comm;
 }
 bslv_memory;
 
@@ -69,10 +89,30 @@ void bslv_info(bslv_memory *mem, int count);
  */
 void bslv_init(bslv_memory *mem, double tol, int max_iter, bsr_matrix const *A, bool use_dilu);
 
+/**
+ * @brief Enable parallel runs.
+ *
+ * @note Inner products are restricted to owner entries by the mask and summed
+ *       over all processes. Preconditioned vectors are made consistent by
+ *       exchanging overlap entries. The preconditioner is block-Jacobi across
+ *       processes with ILU0 or DILU on each process.
+ *
+ * @param mem Pointer to solver memory object.
+ * @param ctx Opaque pointer passed to the callbacks.
+ * @param allreduce Callback summing values over all processes.
+ * @param exchange Callback copying owner entries to overlap entries.
+ * @param mask Pointer to array with one for owner entries and zero otherwise.
+ */
+void bslv_set_comm(bslv_memory *mem, void *ctx,
+                   void (*allreduce)(void *ctx, double *values, int count),
+                   void (*exchange)(void *ctx, double *x),
+                   const double *mask);
+
 /**
  * @brief Preconditioned bicgstab in mixed-precision.
  *
  * @note Preconditioner is either ILU0 or DILU based on value of mem->use_dilu
+ * @note Supports 2x2, 3x3, and 4x4 blocks.
  *
  * @param mem Pointer to solver memory object.
  * @param A Pointer to coeffient matrix in bsr format
@@ -81,12 +121,13 @@ void bslv_init(bslv_memory *mem, double tol, int max_iter, bsr_matrix const *A,
  *
  * @return Number of linear iterations.
  */
-int  bslv_pbicgstab3m(bslv_memory *mem, bsr_matrix *A, const double *b, double *x);
+int  bslv_pbicgstabm(bslv_memory *mem, bsr_matrix *A, const double *b, double *x);
 
 /**
  * @brief Preconditioned bicgstab in double-precision.
  *
  * @note Preconditioner is either ILU0 or DILU based on value of mem->use_dilu
+ * @note Supports 2x2, 3x3, and 4x4 blocks.
  *
  * @param mem Pointer to solver memory object.
  * @param A Pointer to coeffient matrix in bsr format
@@ -95,7 +136,7 @@ int  bslv_pbicgstab3m(bslv_memory *mem, bsr_matrix *A, const double *b, double *
  *
  * @return Number of linear iterations.
  */
-int  bslv_pbicgstab3d(bslv_memory *mem, bsr_matrix *A, const double *b, double *x);
+int  bslv_pbicgstabd(bslv_memory *mem, bsr_matrix *A, const double *b, double *x);
 
 #ifdef __cplusplus
 }
@@ -79,7 +79,11 @@ void bsr_vmspmv3(bsr_matrix *A, const double *x, double *y)
 
     const int b=3;
 
-    __m256d mm_zeros =_mm256_setzero_pd();
+    const __m256d mm_zeros =_mm256_setzero_pd();
+    const __m256i mm_mask3 =_mm256_set_epi64x(0,-1,-1,-1);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
     for(int i=0;i<nrows;i++)
     {
         __m256d vA[3];
@@ -97,13 +101,10 @@ void bsr_vmspmv3(bsr_matrix *A, const double *x, double *y)
         }
 
         // sum over columns
-        __m256d vy, vz;
-        vz = vA[0] + vA[1] + vA[2];
+        __m256d vz = vA[0] + vA[1] + vA[2];
 
-        double *y_i = y+b*i;
-        vy = _mm256_loadu_pd(y_i);       // optional blend to keep
-        vz =_mm256_blend_pd(vy,vz,0x7);  // 4th element unchanged
-        _mm256_storeu_pd(y_i,vz);
+        // 4th element belongs to next row and may be written by another thread
+        _mm256_maskstore_pd(y+b*i,mm_mask3,vz);
     }
 }
 
@@ -116,7 +117,11 @@ void bsr_vdspmv3(bsr_matrix *A, const double *x, double *y)
 
     const int b=3;
 
-    __m256d mm_zeros =_mm256_setzero_pd();
+    const __m256d mm_zeros =_mm256_setzero_pd();
+    const __m256i mm_mask3 =_mm256_set_epi64x(0,-1,-1,-1);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
     for(int i=0;i<nrows;i++)
     {
         __m256d vA[3];
@@ -134,17 +139,167 @@ void bsr_vdspmv3(bsr_matrix *A, const double *x, double *y)
         }
 
         // sum over columns
-        __m256d vy, vz;
-        vz = vA[0] + vA[1] + vA[2];
+        __m256d vz = vA[0] + vA[1] + vA[2];
 
-        double *y_i = y+b*i;
-        vy = _mm256_loadu_pd(y_i);       // optional blend to keep
-        vz =_mm256_blend_pd(vy,vz,0x7);  // 4th element unchanged
-        _mm256_storeu_pd(y_i,vz);
+        // 4th element belongs to next row and may be written by another thread
+        _mm256_maskstore_pd(y+b*i,mm_mask3,vz);
     }
 }
 
 
+void bsr_vmspmv2(bsr_matrix *A, const double *x, double *y)
+{
+    int nrows = A->nrows;
+    int *rowptr=A->rowptr;
+    int *colidx=A->colidx;
+    const float *data=A->flt;
+
+    const int b=2;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int i=0;i<nrows;i++)
+    {
+        __m128d vA[2];
+        for(int k=0;k<2;k++) vA[k] = _mm_setzero_pd();
+        for(int k=rowptr[i];k<rowptr[i+1];k++)
+        {
+            const float *AA=data+4*k;
+
+            int j = colidx[k];
+            __m128 vAA = _mm_loadu_ps(AA);
+            vA[0] += _mm_cvtps_pd(vAA)*_mm_set1_pd(x[b*j+0]);
+            vA[1] += _mm_cvtps_pd(_mm_movehl_ps(vAA,vAA))*_mm_set1_pd(x[b*j+1]);
+        }
+
+        // sum over columns
+        _mm_storeu_pd(y+b*i,vA[0]+vA[1]);
+    }
+}
+
+void bsr_vdspmv2(bsr_matrix *A, const double *x, double *y)
+{
+    int nrows = A->nrows;
+    int *rowptr=A->rowptr;
+    int *colidx=A->colidx;
+    const double *data=A->dbl;
+
+    const int b=2;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int i=0;i<nrows;i++)
+    {
+        __m128d vA[2];
+        for(int k=0;k<2;k++) vA[k] = _mm_setzero_pd();
+        for(int k=rowptr[i];k<rowptr[i+1];k++)
+        {
+            const double *AA=data+4*k;
+
+            int j = colidx[k];
+            vA[0] += _mm_loadu_pd(AA+0)*_mm_set1_pd(x[b*j+0]);
+            vA[1] += _mm_loadu_pd(AA+2)*_mm_set1_pd(x[b*j+1]);
+        }
+
+        // sum over columns
+        _mm_storeu_pd(y+b*i,vA[0]+vA[1]);
+    }
+}
+
+void bsr_vmspmv4(bsr_matrix *A, const double *x, double *y)
+{
+    int nrows = A->nrows;
+    int *rowptr=A->rowptr;
+    int *colidx=A->colidx;
+    const float *data=A->flt;
+
+    const int b=4;
+
+    const __m256d mm_zeros =_mm256_setzero_pd();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int i=0;i<nrows;i++)
+    {
+        __m256d vA[4];
+        for(int k=0;k<4;k++) vA[k] = mm_zeros;
+        for(int k=rowptr[i];k<rowptr[i+1];k++)
+        {
+            const float *AA=data+16*k;
+
+            int j = colidx[k];
+            __m256d vx = _mm256_loadu_pd(x+b*j);
+
+            vA[0] += _mm256_cvtps_pd(_mm_loadu_ps(AA+ 0))*_mm256_permute4x64_pd(vx,0b00000000);
+            vA[1] += _mm256_cvtps_pd(_mm_loadu_ps(AA+ 4))*_mm256_permute4x64_pd(vx,0b01010101);
+            vA[2] += _mm256_cvtps_pd(_mm_loadu_ps(AA+ 8))*_mm256_permute4x64_pd(vx,0b10101010);
+            vA[3] += _mm256_cvtps_pd(_mm_loadu_ps(AA+12))*_mm256_permute4x64_pd(vx,0b11111111);
+        }
+
+        // sum over columns
+        _mm256_storeu_pd(y+b*i,(vA[0] + vA[1]) + (vA[2] + vA[3]));
+    }
+}
+
+void bsr_vdspmv4(bsr_matrix *A, const double *x, double *y)
+{
+    int nrows = A->nrows;
+    int *rowptr=A->rowptr;
+    int *colidx=A->colidx;
+    const double *data=A->dbl;
+
+    const int b=4;
+
+    const __m256d mm_zeros =_mm256_setzero_pd();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int i=0;i<nrows;i++)
+    {
+        __m256d vA[4];
+        for(int k=0;k<4;k++) vA[k] = mm_zeros;
+        for(int k=rowptr[i];k<rowptr[i+1];k++)
+        {
+            const double *AA=data+16*k;
+
+            int j = colidx[k];
+            __m256d vx = _mm256_loadu_pd(x+b*j);
+
+            vA[0] += _mm256_loadu_pd(AA+ 0)*_mm256_permute4x64_pd(vx,0b00000000);
+            vA[1] += _mm256_loadu_pd(AA+ 4)*_mm256_permute4x64_pd(vx,0b01010101);
+            vA[2] += _mm256_loadu_pd(AA+ 8)*_mm256_permute4x64_pd(vx,0b10101010);
+            vA[3] += _mm256_loadu_pd(AA+12)*_mm256_permute4x64_pd(vx,0b11111111);
+        }
+
+        // sum over columns
+        _mm256_storeu_pd(y+b*i,(vA[0] + vA[1]) + (vA[2] + vA[3]));
+    }
+}
+
+void bsr_vmspmv(bsr_matrix *A, const double *x, double *y)
+{
+    switch(A->b)
+    {
+        case 2: bsr_vmspmv2(A,x,y); break;
+        case 3: bsr_vmspmv3(A,x,y); break;
+        case 4: bsr_vmspmv4(A,x,y); break;
+        default: assert(0 && "unsupported block size");
+    }
+}
+
+void bsr_vdspmv(bsr_matrix *A, const double *x, double *y)
+{
+    switch(A->b)
+    {
+        case 2: bsr_vdspmv2(A,x,y); break;
+        case 3: bsr_vdspmv3(A,x,y); break;
+        case 4: bsr_vdspmv4(A,x,y); break;
+        default: assert(0 && "unsupported block size");
+    }
+}
+
 
 void bsr_downcast(bsr_matrix *M)
 {
@@ -152,6 +307,9 @@ void bsr_downcast(bsr_matrix *M)
     int b = M->b;
 
     assert(M->flt);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
     for(int i=0;i<b*b*nnz;i++) M->flt[i]=M->dbl[i];
 }
 
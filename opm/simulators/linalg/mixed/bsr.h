@@ -78,6 +78,76 @@ void bsr_vmspmv3(bsr_matrix *A, const double *x, double *y);
  */
 void bsr_vdspmv3(bsr_matrix *A, const double *x, double *y);
 
+/**
+ * @brief Sparse matrix-vector multiplication in mixed precision.
+ *
+ * @note Function is specialized for 2x2 block-sparse matrices.
+ * @note Function uses SSE2 intrinsics.
+ *
+ * @param A Pointer to bsr matrix.
+ * @param x Pointer to input vector.
+ * @param y Pointer to output vector.
+ */
+void bsr_vmspmv2(bsr_matrix *A, const double *x, double *y);
+
+/**
+ * @brief Sparse matrix-vector multiplication in double precision.
+ *
+ * @note Function is specialized for 2x2 block-sparse matrices.
+ * @note Function uses SSE2 intrinsics.
+ *
+ * @param A Pointer to bsr matrix.
+ * @param x Pointer to input vector.
+ * @param y Pointer to output vector.
+ */
+void bsr_vdspmv2(bsr_matrix *A, const double *x, double *y);
+
+/**
+ * @brief Sparse matrix-vector multiplication in mixed precision.
+ *
+ * @note Function is specialized for 4x4 block-sparse matrices.
+ * @note Function uses AVX2 intrinsics.
+ *
+ * @param A Pointer to bsr matrix.
+ * @param x Pointer to input vector.
+ * @param y Pointer to output vector.
+ */
+void bsr_vmspmv4(bsr_matrix *A, const double *x, double *y);
+
+/**
+ * @brief Sparse matrix-vector multiplication in double precision.
+ *
+ * @note Function is specialized for 4x4 block-sparse matrices.
+ * @note Function uses AVX2 intrinsics.
+ *
+ * @param A Pointer to bsr matrix.
+ * @param x Pointer to input vector.
+ * @param y Pointer to output vector.
+ */
+void bsr_vdspmv4(bsr_matrix *A, const double *x, double *y);
+
+/**
+ * @brief Sparse matrix-vector multiplication in mixed precision.
+ *
+ * @note Dispatches to the kernel specialized for the block size of A.
+ *
+ * @param A Pointer to bsr matrix.
+ * @param x Pointer to input vector.
+ * @param y Pointer to output vector.
+ */
+void bsr_vmspmv(bsr_matrix *A, const double *x, double *y);
+
+/**
+ * @brief Sparse matrix-vector multiplication in double precision.
+ *
+ * @note Dispatches to the kernel specialized for the block size of A.
+ *
+ * @param A Pointer to bsr matrix.
+ * @param x Pointer to input vector.
+ * @param y Pointer to output vector.
+ */
+void bsr_vdspmv(bsr_matrix *A, const double *x, double *y);
+
 /**
  * @brief Make single-precision copy of double-precision values.
  *
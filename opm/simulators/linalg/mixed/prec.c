@@ -1,9 +1,16 @@
 #include "prec.h"
 
+#include <math.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <assert.h>
 #include <immintrin.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 prec_t *prec_alloc()
 {
@@ -16,6 +23,18 @@ prec_t *prec_alloc()
     P->noffsets=-1;
     P->offsets=NULL;
 
+    P->lrowptr=NULL;
+    P->lpos=NULL;
+    P->lcolidx=NULL;
+
+    P->nlower=0;
+    P->lower_levelptr=NULL;
+    P->lower_rows=NULL;
+
+    P->nupper=0;
+    P->upper_levelptr=NULL;
+    P->upper_rows=NULL;
+
     return P;
 }
 
@@ -24,6 +43,13 @@ void prec_free(prec_t *P)
     if(P==NULL) return;
 
     if(P->offsets!=NULL) free(P->offsets);
+    if(P->lrowptr!=NULL) free(P->lrowptr);
+    if(P->lpos!=NULL) free(P->lpos);
+    if(P->lcolidx!=NULL) free(P->lcolidx);
+    if(P->lower_levelptr!=NULL) free(P->lower_levelptr);
+    if(P->lower_rows!=NULL) free(P->lower_rows);
+    if(P->upper_levelptr!=NULL) free(P->upper_levelptr);
+    if(P->upper_rows!=NULL) free(P->upper_rows);
     bsr_free(P->U);
     bsr_free(P->D);
     bsr_free(P->L);
@@ -62,6 +88,102 @@ int prec_analyze(bsr_matrix *M, int (*offsets)[3])
     return count;
 }
 
+/**
+ * @brief Group rows by level.
+ *
+ * @param nrows Number of rows.
+ * @param level Level of each row.
+ * @param levelptr Pointer to offsets of levels (allocated).
+ * @param rows Pointer to rows sorted by level (allocated).
+ *
+ * @return Number of levels.
+ */
+static int prec_group_levels(int nrows, const int *level, int **levelptr, int **rows)
+{
+    int nlevels=0;
+    for(int i=0;i<nrows;i++) if(level[i]+1>nlevels) nlevels=level[i]+1;
+
+    int *ptr = calloc(nlevels+1,sizeof(int));
+    int *idx = malloc((nrows>0?nrows:1)*sizeof(int));
+    assert(ptr);
+    assert(idx);
+
+    for(int i=0;i<nrows;i++) ptr[level[i]+1]++;
+    for(int l=0;l<nlevels;l++) ptr[l+1]+=ptr[l];
+    for(int i=0;i<nrows;i++) idx[ptr[level[i]]++]=i; // rows in ascending order within a level
+    for(int l=nlevels;l>0;l--) ptr[l]=ptr[l-1];
+    ptr[0]=0;
+
+    *levelptr=ptr;
+    *rows=idx;
+    return nlevels;
+}
+
+/**
+ * @brief Analyze dependencies of triangular solves.
+ *
+ * @note Sets up row-wise access to L and the level sets of the
+ *       lower and upper triangular solves.
+ *
+ * @param P Pointer preconditioner object.
+ */
+static void prec_analyze_levels(prec_t *P)
+{
+    bsr_matrix const *U=P->U;
+    int nrows=U->nrows;
+
+    // Row-wise order of L from its column-wise storage
+    P->lrowptr = calloc(nrows+1,sizeof(int));
+    P->lpos    = malloc((U->nnz>0?U->nnz:1)*sizeof(int));
+    P->lcolidx = malloc((U->nnz>0?U->nnz:1)*sizeof(int));
+    assert(P->lrowptr);
+    assert(P->lpos);
+    assert(P->lcolidx);
+
+    for(int k=0;k<U->nnz;k++) P->lrowptr[U->colidx[k]+1]++;
+    for(int i=0;i<nrows;i++) P->lrowptr[i+1]+=P->lrowptr[i];
+    for(int j=0;j<nrows;j++)
+    {
+        for(int k=U->rowptr[j];k<U->rowptr[j+1];k++)
+        {
+            int i=U->colidx[k];
+            int t=P->lrowptr[i]++;
+            P->lpos[t]=k;     // block L(i,j)
+            P->lcolidx[t]=j;
+        }
+    }
+    for(int i=nrows;i>0;i--) P->lrowptr[i]=P->lrowptr[i-1];
+    P->lrowptr[0]=0;
+
+    int *level = calloc(nrows>0?nrows:1,sizeof(int));
+    assert(level);
+
+    // Lower triangular solve, row i depends on rows j<i
+    for(int i=0;i<nrows;i++)
+    {
+        level[i]=0;
+        for(int t=P->lrowptr[i];t<P->lrowptr[i+1];t++)
+        {
+            int l=level[P->lcolidx[t]]+1;
+            if(l>level[i]) level[i]=l;
+        }
+    }
+    P->nlower = prec_group_levels(nrows,level,&P->lower_levelptr,&P->lower_rows);
+
+    // Upper triangular solve, row i depends on rows j>i
+    for(int i=nrows-1;i>=0;i--)
+    {
+        level[i]=0;
+        for(int k=U->rowptr[i];k<U->rowptr[i+1];k++)
+        {
+            int l=level[U->colidx[k]]+1;
+            if(l>level[i]) level[i]=l;
+        }
+    }
+    P->nupper = prec_group_levels(nrows,level,&P->upper_levelptr,&P->upper_rows);
+
+    free(level);
+}
 
 void prec_init(prec_t *P, bsr_matrix const *A)
 {
@@ -117,6 +239,9 @@ void prec_init(prec_t *P, bsr_matrix const *A)
     count = prec_analyze(U,P->offsets);
     P->offsets[count][0]=U->nnz;
     P->noffsets=count;
+
+    // dependencies for level-scheduled application
+    prec_analyze_levels(P);
 }
 
 /**
@@ -194,17 +319,6 @@ void mat3_inv(double *invA, const double *A)
     for(int k=0;k<9;k++) invA[k]=M[k]/detA;
 }
 
-/**
- * @brief vector copy of 9-element vectors.
- *
- * @param y Pointer to output vector.
- * @param x Pointer to input vector.
- */
-static inline void vec_copy9(double *y, double const *x)
-{
-    for(int i=0;i<9;i++) y[i]=x[i];
-}
-
 /**
  * @brief In-place right matrix-matrix multiplication for 3x3 matrices.
  *
@@ -314,6 +428,147 @@ void mat3_vfms(double *C, double const *A, double const *B)
     }
 }
 
+/**
+ * @brief Matrix inverse for bxb matrix.
+ *
+ * @note Gauss-Jordan elimination with partial pivoting.
+ *
+ * @param invA Pointer to inverse matrix.
+ * @param    A Pointer to input matrix.
+ * @param    b Block size (at most 4).
+ */
+void mat_inv(double *invA, const double *A, int b)
+{
+    // assume bxb column-major matrices
+    double M[16], I[16];
+    for(int k=0;k<b*b;k++) M[k]=A[k];
+    for(int k=0;k<b*b;k++) I[k]=0.0;
+    for(int k=0;k<b;k++) I[k+b*k]=1.0;
+
+    for(int c=0;c<b;c++)
+    {
+        int p=c;
+        for(int r=c+1;r<b;r++) if(fabs(M[r+b*c])>fabs(M[p+b*c])) p=r;
+        if(p!=c)
+        {
+            for(int k=0;k<b;k++)
+            {
+                double t;
+                t=M[c+b*k]; M[c+b*k]=M[p+b*k]; M[p+b*k]=t;
+                t=I[c+b*k]; I[c+b*k]=I[p+b*k]; I[p+b*k]=t;
+            }
+        }
+
+        double d=1.0/M[c+b*c];
+        for(int k=0;k<b;k++) {M[c+b*k]*=d; I[c+b*k]*=d;}
+        for(int r=0;r<b;r++)
+        {
+            if(r==c) continue;
+            double f=M[r+b*c];
+            for(int k=0;k<b;k++) {M[r+b*k]-=f*M[c+b*k]; I[r+b*k]-=f*I[c+b*k];}
+        }
+    }
+    for(int k=0;k<b*b;k++) invA[k]=I[k];
+}
+
+/**
+ * @brief Fused multiply-subtract for bxb matrices.
+ *
+ * @param C Pointer to output matrix.
+ * @param A Pointer to left input matrix.
+ * @param B Pointer to right input matrix.
+ * @param b Block size (at most 4).
+ */
+void mat_matfms(double *C, const double *A, const double *B, int b)
+{
+    // assume bxb column-major matrices
+    // account for possiblity of C and A or B referring to same memory location
+    double M[16];
+    for(int k=0;k<b*b;k++) M[k]=0.0;
+    for(int j=0;j<b;j++)
+    {
+        double *m_j = M+b*j;        // j-th column of M
+        for(int k=0;k<b;k++)
+        {
+            double b_kj = B[k+b*j]; // kj-th element of B
+            double const *a_k = A+b*k;    // k-th column of A
+            for(int i=0;i<b;i++) m_j[i] += a_k[i]*b_kj; // |m_j> += |a_k> * b_kj;
+        }
+    }
+    for(int k=0;k<b*b;k++) C[k]-=M[k];
+}
+
+/**
+ * @brief Matrix-matrix multiplication of bxb matrices.
+ *
+ * @param C Pointer to output matrix.
+ * @param A Pointer to left input matrix.
+ * @param B Pointer to right input matrix.
+ * @param b Block size (at most 4).
+ */
+void mat_matmul(double *C, const double *A, const double *B, int b)
+{
+    // assume bxb column-major matrices
+    // account for possiblity of C and A or B referring to same memory location
+    double M[16];
+    for(int k=0;k<b*b;k++) M[k]=0.0;
+    for(int j=0;j<b;j++)
+    {
+        double *m_j = M+b*j;        // j-th column of M
+        for(int k=0;k<b;k++)
+        {
+            double b_kj = B[k+b*j]; // kj-th element of B
+            double const *a_k = A+b*k;    // k-th column of A
+            for(int i=0;i<b;i++) m_j[i] += a_k[i]*b_kj; // |m_j> += |a_k> * b_kj;
+        }
+    }
+    for(int k=0;k<b*b;k++) C[k]=M[k];
+}
+
+/**
+ * @brief Block inverse dispatched on block size.
+ */
+static inline void blk_inv(double *invA, const double *A, int b)
+{
+    if(b==3) mat3_inv(invA,A);
+    else mat_inv(invA,A,b);
+}
+
+/**
+ * @brief In-place right block multiplication A=A*B dispatched on block size.
+ */
+static inline void blk_rmul(double *A, const double *B, int b)
+{
+    if(b==3) mat3_rmul(A,B);
+    else mat_matmul(A,A,B,b);
+}
+
+/**
+ * @brief In-place left block multiplication B=A*B dispatched on block size.
+ */
+static inline void blk_lmul(const double *A, double *B, int b)
+{
+    if(b==3) mat3_lmul(A,B);
+    else mat_matmul(B,A,B,b);
+}
+
+/**
+ * @brief Fused block multiply-subtract C-=A*B dispatched on block size.
+ */
+static inline void blk_vfms(double *C, const double *A, const double *B, int b)
+{
+    if(b==3) mat3_vfms(C,A,B);
+    else mat_matfms(C,A,B,b);
+}
+
+/**
+ * @brief Block copy.
+ */
+static inline void blk_copy(double *y, double const *x, int bb)
+{
+    for(int i=0;i<bb;i++) y[i]=x[i];
+}
+
 
 void prec_dilu_factorize(prec_t *P, bsr_matrix *A)
 {
@@ -335,16 +590,16 @@ void prec_dilu_factorize(prec_t *P, bsr_matrix *A)
             if(j<i)       // struct-transpose of L
             {
                 int kL = L->rowptr[j];
-                vec_copy9(L->dbl + bb*kL, A->dbl + bb*k);
+                blk_copy(L->dbl + bb*kL, A->dbl + bb*k, bb);
                 L->rowptr[j]++;
             }
             else if(j==i) // struct-copy of D
             {
-                vec_copy9(D->dbl + bb*i, A->dbl + bb*k);
+                blk_copy(D->dbl + bb*i, A->dbl + bb*k, bb);
             }
             else if(j>i) // struct-copy of U
             {
-                vec_copy9(U->dbl + bb*kU, A->dbl + bb*k);
+                blk_copy(U->dbl + bb*kU, A->dbl + bb*k, bb);
                 kU++;
             }
         }
@@ -354,22 +609,22 @@ void prec_dilu_factorize(prec_t *P, bsr_matrix *A)
     L->rowptr[0]=0;
 
     // Factorizing
-    double scale[9]; //hard-coded to 3x3 blocks for now
+    double scale[16]; // up to 4x4 blocks
     for(int i=0;i<A->nrows;i++)
     {
-        mat3_inv(scale,D->dbl+i*bb);
-        vec_copy9(D->dbl+bb*i, scale); //store inverse instead to simplify application
+        blk_inv(scale,D->dbl+i*bb,b);
+        blk_copy(D->dbl+bb*i, scale, bb); //store inverse instead to simplify application
         for(int k=L->rowptr[i];k<L->rowptr[i+1];k++)
         {
             //scale column i of L
-            mat3_rmul(L->dbl+k*bb,scale);
+            blk_rmul(L->dbl+k*bb,scale,b);
 
             //update diagonal of U
             int j=L->colidx[k];
-            mat3_vfms(D->dbl+j*bb,L->dbl+k*bb,U->dbl+k*bb);
+            blk_vfms(D->dbl+j*bb,L->dbl+k*bb,U->dbl+k*bb,b);
 
             //scale row i of U
-            mat3_lmul(scale,U->dbl+k*bb);
+            blk_lmul(scale,U->dbl+k*bb,b);
 
             //NOT IMPLEMENTED!
             for(int m=L->rowptr[j];m<L->rowptr[j+1];m++)
@@ -405,16 +660,16 @@ void prec_ilu0_factorize(prec_t *P, bsr_matrix *A)
             if(j<i)       // struct-transpose of L
             {
                 int kL = L->rowptr[j];
-                vec_copy9(L->dbl + bb*kL, A->dbl + bb*k);
+                blk_copy(L->dbl + bb*kL, A->dbl + bb*k, bb);
                 L->rowptr[j]++;
             }
             else if(j==i) // struct-copy of D
             {
-                vec_copy9(D->dbl + bb*i, A->dbl + bb*k);
+                blk_copy(D->dbl + bb*i, A->dbl + bb*k, bb);
             }
             else if(j>i) // struct-copy of U
             {
-                vec_copy9(U->dbl + bb*kU, A->dbl + bb*k);
+                blk_copy(U->dbl + bb*kU, A->dbl + bb*k, bb);
                 kU++;
             }
         }
@@ -426,19 +681,19 @@ void prec_ilu0_factorize(prec_t *P, bsr_matrix *A)
     // Factorizing
     int idx=0;
     int next = P->offsets[idx][0];
-    double scale[9]; //hard-coded to 3x3 blocks for now
+    double scale[16]; // up to 4x4 blocks
     for(int i=0;i<A->nrows;i++)
     {
-        mat3_inv(scale,D->dbl+i*bb);
-        vec_copy9(D->dbl+bb*i, scale); //store inverse instead to simplify application
+        blk_inv(scale,D->dbl+i*bb,b);
+        blk_copy(D->dbl+bb*i, scale, bb); //store inverse instead to simplify application
         for(int k=L->rowptr[i];k<L->rowptr[i+1];k++)
         {
             //scale column i of L
-            mat3_rmul(L->dbl+k*bb,scale);
+            blk_rmul(L->dbl+k*bb,scale,b);
 
             //update diagonal D
             int j=L->colidx[k];
-            mat3_vfms(D->dbl+j*bb,L->dbl+k*bb,U->dbl+k*bb);
+            blk_vfms(D->dbl+j*bb,L->dbl+k*bb,U->dbl+k*bb,b);
         }
 
         while(next<U->rowptr[i+1])
@@ -448,8 +703,8 @@ void prec_ilu0_factorize(prec_t *P, bsr_matrix *A)
             int jk = P->offsets[idx][2];
 
             //update off-diagonals L and U
-            mat3_vfms(U->dbl+jk*bb,L->dbl+ij*bb,U->dbl+ik*bb);
-            mat3_vfms(L->dbl+jk*bb,L->dbl+ik*bb,U->dbl+ij*bb);
+            blk_vfms(U->dbl+jk*bb,L->dbl+ij*bb,U->dbl+ik*bb,b);
+            blk_vfms(L->dbl+jk*bb,L->dbl+ik*bb,U->dbl+ij*bb,b);
 
             //update marker
             next=P->offsets[++idx][0];
@@ -458,7 +713,7 @@ void prec_ilu0_factorize(prec_t *P, bsr_matrix *A)
         for(int k=L->rowptr[i];k<L->rowptr[i+1];k++)
         {
             //scale row i of U
-            mat3_lmul(scale,U->dbl+k*bb);
+            blk_lmul(scale,U->dbl+k*bb,b);
         }
 
     }
@@ -656,6 +911,128 @@ void prec_dapply3c(prec_t *restrict P, double *x)
     }
 }
 
+/**
+ * @brief Value of nonzero in single or double precision.
+ */
+static inline double prec_value(const bsr_matrix *M, int idx, bool mixed)
+{
+    return mixed ? (double)M->flt[idx] : M->dbl[idx];
+}
+
+/**
+ * @brief Level-scheduled preconditioner application.
+ *
+ * @note Rows within a level are independent and processed concurrently.
+ * @note Function is inlined for each block size such that loops over
+ *       block entries are fully unrolled and vectorized.
+ *
+ * @param P Pointer to preconditioner object.
+ * @param x Pointer to input/output vector
+ * @param b Block size (at most 4).
+ * @param mixed Use single-precision (true) or double-precision (false) factors.
+ */
+static inline __attribute__((always_inline))
+void prec_apply_levels(prec_t *restrict P, double *x, const int b, const bool mixed)
+{
+    const bsr_matrix *L  = P->L;
+    const bsr_matrix *D  = P->D;
+    const bsr_matrix *U  = P->U;
+
+    const int bb=b*b;
+
+    // Lower triangular solve assuming ones on diagonal
+    for(int l=0;l<P->nlower;l++)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int q=P->lower_levelptr[l];q<P->lower_levelptr[l+1];q++)
+        {
+            int i=P->lower_rows[q];
+            double z[4];
+            for(int r=0;r<b;r++) z[r]=x[b*i+r];
+            for(int t=P->lrowptr[i];t<P->lrowptr[i+1];t++)
+            {
+                int k=P->lpos[t];
+                const double *xj=x+b*P->lcolidx[t];
+                for(int c=0;c<b;c++)
+                {
+                    for(int r=0;r<b;r++) z[r]-=prec_value(L,k*bb+c*b+r,mixed)*xj[c];
+                }
+            }
+            for(int r=0;r<b;r++) x[b*i+r]=z[r];
+        }
+    }
+
+    // Muliply by (inverse) diagonal block and upper triangular solve
+    for(int l=0;l<P->nupper;l++)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int q=P->upper_levelptr[l];q<P->upper_levelptr[l+1];q++)
+        {
+            int i=P->upper_rows[q];
+            const double *xi=x+b*i;
+            double z[4];
+            for(int r=0;r<b;r++) z[r]=0.0;
+            for(int c=0;c<b;c++)
+            {
+                for(int r=0;r<b;r++) z[r]+=prec_value(D,i*bb+c*b+r,mixed)*xi[c];
+            }
+            for(int k=U->rowptr[i];k<U->rowptr[i+1];k++)
+            {
+                const double *xj=x+b*U->colidx[k];
+                for(int c=0;c<b;c++)
+                {
+                    for(int r=0;r<b;r++) z[r]-=prec_value(U,k*bb+c*b+r,mixed)*xj[c];
+                }
+            }
+            for(int r=0;r<b;r++) x[b*i+r]=z[r];
+        }
+    }
+}
+
+/**
+ * @brief Number of threads available for preconditioner application.
+ */
+static int prec_num_threads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+void prec_mapply(prec_t *P, double *x)
+{
+    switch(P->L->b)
+    {
+        case 2: prec_apply_levels(P,x,2,true); break;
+        case 3:
+            if(prec_num_threads()==1) prec_mapply3c(P,x);
+            else prec_apply_levels(P,x,3,true);
+            break;
+        case 4: prec_apply_levels(P,x,4,true); break;
+        default: assert(0 && "unsupported block size");
+    }
+}
+
+void prec_dapply(prec_t *P, double *x)
+{
+    switch(P->L->b)
+    {
+        case 2: prec_apply_levels(P,x,2,false); break;
+        case 3:
+            if(prec_num_threads()==1) prec_dapply3c(P,x);
+            else prec_apply_levels(P,x,3,false);
+            break;
+        case 4: prec_apply_levels(P,x,4,false); break;
+        default: assert(0 && "unsupported block size");
+    }
+}
+
 void prec_downcast(prec_t *P)
 {
     bsr_downcast(P->L);
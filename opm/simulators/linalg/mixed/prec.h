@@ -22,6 +22,27 @@ struct prec_t
     int noffsets;
     // triplets uniquely identifying off-diagonal ilu0 updates
     int(*offsets)[3];
+
+    // row offsets of L in row-wise (gather) order
+    int *lrowptr;
+    // positions of the nonzero blocks of L in row-wise order
+    int *lpos;
+    // column indices of L in row-wise order
+    int *lcolidx;
+
+    // number of levels of lower triangular solve
+    int nlower;
+    // offsets of levels of lower triangular solve
+    int *lower_levelptr;
+    // rows sorted by level of lower triangular solve
+    int *lower_rows;
+
+    // number of levels of upper triangular solve
+    int nupper;
+    // offsets of levels of upper triangular solve
+    int *upper_levelptr;
+    // rows sorted by level of upper triangular solve
+    int *upper_rows;
 }
 prec_t;
 
@@ -93,6 +114,28 @@ void prec_mapply3c(prec_t *P, double *x);
  */
 void prec_dapply3c(prec_t *P, double *x);
 
+/**
+ * @brief Preconditioner application in mixed-precision.
+ *
+ * @note Dispatches on block size. Multithreaded runs and block sizes
+ *       other than 3x3 use level-scheduled triangular solves.
+ *
+ * @param P Pointer to preconditioner object.
+ * @apram x Pointer to input/output vector
+ */
+void prec_mapply(prec_t *P, double *x);
+
+/**
+ * @brief Preconditioner application in double-precision.
+ *
+ * @note Dispatches on block size. Multithreaded runs and block sizes
+ *       other than 3x3 use level-scheduled triangular solves.
+ *
+ * @param P Pointer to preconditioner object.
+ * @apram x Pointer to input/output vector
+ */
+void prec_dapply(prec_t *P, double *x);
+
 /**
  * @brief Make single-precision copy of double-precision values.
  *
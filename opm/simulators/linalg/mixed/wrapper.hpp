@@ -4,17 +4,23 @@
 #include <opm/simulators/flow/BlackoilModelParameters.hpp>
 #include <opm/simulators/linalg/FlowLinearSolverParameters.hpp>
 
+#include <dune/istl/paamg/pinfo.hh>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
 #include "bsr.h"
 #include "bslv.h"
 
 namespace Dune
 {
-template <class X, class M>
+template <class X, class M, class Comm = Dune::Amg::SequentialInformation>
 class MixedSolver : public InverseOperator<X,X>
 {
     public:
 
-    MixedSolver(const M &A, double tol, int maxiter, bool use_dilu)
+    MixedSolver(const M &A, double tol, int maxiter, bool use_dilu, const Comm& comm = Comm())
     {
         // verify that well contributions are added to the matrix
         if (!Opm::Parameters::Get<Opm::Parameters::MatrixAddWellContributions>()) {
@@ -25,8 +31,8 @@ class MixedSolver : public InverseOperator<X,X>
         int nnz   = A.nonzeroes();
         int b     = A[0][0].N();
 
-        // verify that block size is 3x3
-        if (b!=3) {OPM_THROW(std::logic_error, "Block sizes other than 3x3 are not supported by mixed precision.");}
+        // verify that block size is supported
+        if (b<2 || b>4) {OPM_THROW(std::logic_error, "Only 2x2, 3x3, and 4x4 blocks are supported by mixed precision.");}
 
         // create jacobian matrix object and allocate various arrays
         jacobian_ = bsr_alloc();
@@ -53,6 +59,19 @@ class MixedSolver : public InverseOperator<X,X>
         mem_ = bslv_alloc();
         bslv_init(mem_, tol, maxiter, jacobian_, use_dilu);
 
+        // in parallel runs, overlap rows are expected to be decoupled
+        // (see makeOverlapRowsInvalid) such that ILU0/DILU is block-Jacobi
+        if constexpr (!std::is_same_v<Comm, Dune::Amg::SequentialInformation>) {
+            if (comm.communicator().size() > 1) {
+                comm_ = &comm;
+                halo_.resize(nrows);
+                halo_ = 1.0;
+                comm.project(halo_);
+                mask_.assign(&halo_[0][0], &halo_[0][0] + mem_->n);
+                bslv_set_comm(mem_, this, &MixedSolver::allreduce, &MixedSolver::exchange, mask_.data());
+            }
+        }
+
         //pointer to nonzero blocks
         data_ = &A[0][0][0][0];
     }
@@ -67,19 +86,24 @@ class MixedSolver : public InverseOperator<X,X>
     virtual void apply (X& x, X& b, InverseOperatorResult& res) override
     {
         // transpose each dense block to make them column-major
-        double B[9];
+        const int bs = jacobian_->b;
+        const int bb = bs*bs;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int k=0;k<jacobian_->nnz;k++)
         {
-            for(int i=0;i<3;i++) for(int j=0;j<3;j++) B[3*j+i] = data_[9*k + 3*i + j];
-            for(int i=0;i<9;i++) jacobian_->dbl[9*k + i] = B[i];
+            double B[16];
+            for(int i=0;i<bs;i++) for(int j=0;j<bs;j++) B[bs*j+i] = data_[bb*k + bs*i + j];
+            for(int i=0;i<bb;i++) jacobian_->dbl[bb*k + i] = B[i];
         }
 
         // downcast to allow mixed precision
         bsr_downcast(jacobian_);
 
         // solve linear system
-        int count = bslv_pbicgstab3m(mem_, jacobian_, &b[0][0], &x[0][0]);
-        //int count = bslv_pbicgstab3d(mem_, jacobian_, &b[0][0], &x[0][0]);
+        int count = bslv_pbicgstabm(mem_, jacobian_, &b[0][0], &x[0][0]);
+        //int count = bslv_pbicgstabd(mem_, jacobian_, &b[0][0], &x[0][0]);
 
         // return convergence information
         res.converged  = (mem_->e[count] < mem_->tol);
@@ -96,15 +120,38 @@ class MixedSolver : public InverseOperator<X,X>
 
     }
 
-    virtual Dune::SolverCategory::Category category() const override { return Dune::SolverCategory::sequential; };
+    virtual Dune::SolverCategory::Category category() const override
+    {
+        return comm_ ? Dune::SolverCategory::overlapping : Dune::SolverCategory::sequential;
+    }
 
     private:
     bsr_matrix  *jacobian_;
     bslv_memory *mem_;
     double const *data_;
+
+    // communication in parallel runs
+    const Comm *comm_ = nullptr;
+    // owner mask and buffer for halo exchange
+    std::vector<double> mask_;
+    X halo_;
+
+    static void allreduce(void *ctx, double *values, int count)
+    {
+        const auto& self = *static_cast<MixedSolver*>(ctx);
+        self.comm_->communicator().sum(values, count);
+    }
+
+    static void exchange(void *ctx, double *x)
+    {
+        auto& self = *static_cast<MixedSolver*>(ctx);
+        const int n = self.mem_->n;
+        std::copy_n(x, n, &self.halo_[0][0]);
+        self.comm_->copyOwnerToAll(self.halo_, self.halo_);
+        std::copy_n(&self.halo_[0][0], n, x);
+    }
 };
 
 }
 
 #endif // OPM_MIXED_SOLVER_HEADER_INCLUDED
-
@@ -266,6 +266,9 @@ protected:
     bool full_timestep_initially_{false};    //!< beginning with the size of the time step from data file
     double timestep_after_event_{};          //!< suggested size of timestep after an event
     bool use_newton_iteration_{false};       //!< use newton iteration count for adaptive time step control
+    double time_step_control_tolerance_{};   //!< tolerance of the relative change before a time step is rejected
+    double time_step_control_safety_factor_{}; //!< safety factor applied to the reduced step after a rejection
+    bool enable_tuning_{false};              //!< whether the TUNING keyword is honoured
 
     //! < shut problematic wells when time step size in days are less than this
     double min_time_step_before_shutting_problematic_wells_{};
@@ -89,6 +89,10 @@ AdaptiveTimeStepping(const UnitSystem& unit_system,
     , timestep_after_event_{
         Parameters::Get<Parameters::TimeStepAfterEventInDays<Scalar>>() * 24 * 60 * 60} // 1e30
     , use_newton_iteration_{false}
+    , time_step_control_tolerance_{Parameters::Get<Parameters::TimeStepControlTolerance>()} // 1e-1
+    , time_step_control_safety_factor_{
+        Parameters::Get<Parameters::TimeStepControlSafetyFactor>()} // 0.8
+    , enable_tuning_{Parameters::Get<Parameters::EnableTuning>()} // false
     , min_time_step_before_shutting_problematic_wells_{
         Parameters::Get<Parameters::MinTimeStepBeforeShuttingProblematicWellsInDays>() * unit::day}
     , report_(report)
@@ -126,6 +130,10 @@ AdaptiveTimeStepping(double max_next_tstep,
     , full_timestep_initially_{Parameters::Get<Parameters::FullTimeStepInitially>()} // false
     , timestep_after_event_{tuning.TMAXWC} // 1e30
     , use_newton_iteration_{false}
+    , time_step_control_tolerance_{Parameters::Get<Parameters::TimeStepControlTolerance>()} // 1e-1
+    , time_step_control_safety_factor_{
+        Parameters::Get<Parameters::TimeStepControlSafetyFactor>()} // 0.8
+    , enable_tuning_{Parameters::Get<Parameters::EnableTuning>()} // false
     , min_time_step_before_shutting_problematic_wells_{
         Parameters::Get<Parameters::MinTimeStepBeforeShuttingProblematicWellsInDays>() * unit::day}
     , report_(report)
@@ -859,8 +867,8 @@ run()
 
             double new_time_step = restartFactor_() * dt;
             if (substep_report.time_step_rejected) {
-                const double tol = Parameters::Get<Parameters::TimeStepControlTolerance>();
-                const double safetyFactor = Parameters::Get<Parameters::TimeStepControlSafetyFactor>();
+                const double tol = this->adaptive_time_stepping_.time_step_control_tolerance_;
+                const double safetyFactor = this->adaptive_time_stepping_.time_step_control_safety_factor_;
                 const double temp_time_step = std::sqrt(safetyFactor * tol / solver_().model().relativeChange()) * dt;
                 if (temp_time_step < dt) { // added in case suggested time step is not a reduction
                     new_time_step = temp_time_step;
@@ -942,7 +950,7 @@ checkTimeStepMinLimit_(const double new_time_step) const
     // much, we have failed and throw an exception.
     if (new_time_step < minTimeStep_()) {
         std::string msg = "Solver failed to converge after cutting timestep to ";
-        if (Parameters::Get<Parameters::EnableTuning>()) {
+        if (this->adaptive_time_stepping_.enable_tuning_) {
             const UnitSystem& unit_system = solver_().model().simulator().vanguard().eclState().getDeckUnitSystem();
             msg += fmt::format(
                 "{:.3E} {}\nwhich is the minimum threshold given by the TUNING keyword\n",
@@ -357,6 +357,16 @@ namespace Opm
                 && !network_needs_more_balancing_force_another_newton_iteration_;
         }
 
+        bool wellGroupTargetsViolated() const
+        {
+            return wellGroupTargetsViolated_;
+        }
+
+        bool networkNotYetBalancedForceAnotherNewtonIteration() const
+        {
+            return network_needs_more_balancing_force_another_newton_iteration_;
+        }
+
         bool reservoirFailed() const
         {
             return status_ & ReservoirFailed;
@@ -34,7 +34,8 @@ namespace Opm
     {
         return SimulatorReportSingle{1.0, 2.0, 3.0, 4.0, 5.0, 6.0,
                                      7.0, 8.0, 9.0, 10.0, 11.0, 12.0,
-                                     13, 14, 15, 16, 17, 18,
+                                     13, 14, 15, 16, 17, 18, 30, 31,
+                                     32.0, 33.0, 34,
                                      true, false, false, 19, 20.0, 21.0,
                                      22, 23, 24, 25, 26, 27, 28, 29};
     }
@@ -59,6 +60,11 @@ namespace Opm
                this->total_linear_iterations == rhs.total_linear_iterations &&
                this->min_linear_iterations == rhs.min_linear_iterations &&
                this->max_linear_iterations == rhs.max_linear_iterations &&
+               this->updated_intensive_quantities == rhs.updated_intensive_quantities &&
+               this->skipped_intensive_quantities == rhs.skipped_intensive_quantities &&
+               this->checkpoint_time == rhs.checkpoint_time &&
+               this->checkpoint_write_time == rhs.checkpoint_write_time &&
+               this->checkpoint_bytes == rhs.checkpoint_bytes &&
                this->converged == rhs.converged &&
                this->time_step_rejected == rhs.time_step_rejected &&
                this->well_group_control_changed == rhs.well_group_control_changed &&
@@ -97,6 +103,11 @@ namespace Opm
             min_linear_iterations = std::min(min_linear_iterations, sr.total_linear_iterations);
         }
         max_linear_iterations = std::max(max_linear_iterations, sr.total_linear_iterations);
+        updated_intensive_quantities += sr.updated_intensive_quantities;
+        skipped_intensive_quantities += sr.skipped_intensive_quantities;
+        checkpoint_time += sr.checkpoint_time;
+        checkpoint_write_time += sr.checkpoint_write_time;
+        checkpoint_bytes += sr.checkpoint_bytes;
 
         converged_domains += sr.converged_domains;
         unconverged_domains += sr.unconverged_domains;
@@ -237,6 +248,22 @@ namespace Opm
                             100.0*failureReport->total_linear_iterations/noZero(n));
         }
         os << std::endl;
+
+        const std::size_t skipped = skipped_intensive_quantities +
+            (failureReport ? failureReport->skipped_intensive_quantities : 0);
+        const std::size_t updated = updated_intensive_quantities +
+            (failureReport ? failureReport->updated_intensive_quantities : 0);
+        if (skipped + updated > 0) {
+            os << fmt::format("Skipped Cell Updates:      {:7} of {} ({:2.1f}%)\n",
+                              skipped, skipped + updated, 100.0*skipped/(skipped + updated));
+        }
+
+        if (checkpoint_bytes > 0) {
+            os << fmt::format("Checkpoints:               {:7.2f} s blocking, "
+                              "{:.2f} s writing, {:.1f} MB\n",
+                              checkpoint_time, checkpoint_write_time,
+                              checkpoint_bytes / (1024.0 * 1024.0));
+        }
     }
 
 
@@ -22,6 +22,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <cstddef>
 #include <iosfwd>
 #include <limits>
 #include <vector>
@@ -52,6 +53,17 @@ namespace Opm
         unsigned int min_linear_iterations = std::numeric_limits<unsigned int>::max();
         unsigned int max_linear_iterations = 0;
 
+        // Cells whose intensive quantities were updated or skipped in the
+        // incremental mode (--incremental-intensive-quantities).
+        std::size_t updated_intensive_quantities = 0;
+        std::size_t skipped_intensive_quantities = 0;
+
+        // Serialized state checkpoints (--save-step): time the simulation was
+        // blocked, time spent writing and number of bytes written.
+        double checkpoint_time = 0.0;
+        double checkpoint_write_time = 0.0;
+        std::size_t checkpoint_bytes = 0;
+
         bool converged = false;
         bool time_step_rejected = false;
         bool well_group_control_changed = false;
@@ -101,6 +113,11 @@ namespace Opm
             serializer(total_linear_iterations);
             serializer(min_linear_iterations);
             serializer(max_linear_iterations);
+            serializer(updated_intensive_quantities);
+            serializer(skipped_intensive_quantities);
+            serializer(checkpoint_time);
+            serializer(checkpoint_write_time);
+            serializer(checkpoint_bytes);
             serializer(converged);
             serializer(time_step_rejected);
             serializer(well_group_control_changed);
@@ -32,8 +32,11 @@
 
 #include <opm/grid/common/CommunicationUtils.hpp>
 
+#include <mpi.h>
+
 #include <algorithm>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -131,6 +134,86 @@ namespace {
 
         this->unpack(report);
     }
+
+    /// Fixed-size part of a convergence report, combined across all ranks
+    /// by a single reduction.
+    struct ReportSummary
+    {
+        /// Report time.  Combined by maximum.
+        double reportTime{};
+
+        /// Bitwise combination of ConvergenceReport::Status values.
+        /// Combined by bitwise or.
+        int status{};
+
+        /// Whether or not well or group targets are violated.  Combined
+        /// by logical or.
+        int wellGroupTargetsViolated{};
+
+        /// Whether or not the network needs another Newton iteration.
+        /// Combined by logical or.
+        int networkNotYetBalanced{};
+
+        /// Number of ranks with a CNV pore-volume split.  Combined by sum.
+        int numCnvPvSplits{};
+
+        explicit ReportSummary(const Opm::ConvergenceReport& report)
+            : reportTime               { report.reportTime() }
+            , status                   { (report.reservoirFailed()
+                                          ? Opm::ConvergenceReport::ReservoirFailed : 0)
+                                       | (report.wellFailed()
+                                          ? Opm::ConvergenceReport::WellFailed : 0) }
+            , wellGroupTargetsViolated { report.wellGroupTargetsViolated() }
+            , networkNotYetBalanced    { report.networkNotYetBalancedForceAnotherNewtonIteration() }
+            , numCnvPvSplits           { report.cnvPvSplit().first.empty() ? 0 : 1 }
+        {}
+    };
+
+    void combineReportSummaries(void* in, void* inout, int* len, MPI_Datatype*)
+    {
+        const auto* src = static_cast<const ReportSummary*>(in);
+        auto* dest = static_cast<ReportSummary*>(inout);
+
+        for (int i = 0; i < *len; ++i, ++src, ++dest) {
+            dest->reportTime = std::max(dest->reportTime, src->reportTime);
+            dest->status |= src->status;
+            dest->wellGroupTargetsViolated |= src->wellGroupTargetsViolated;
+            dest->networkNotYetBalanced |= src->networkNotYetBalanced;
+            dest->numCnvPvSplits += src->numCnvPvSplits;
+        }
+    }
+
+    /// Combine the report summaries of all ranks.
+    ///
+    /// \param[in] report Local convergence report from the current MPI
+    /// rank.
+    ///
+    /// \param[in] comm MPI communicator.
+    ///
+    /// \return Combined summary, equal on all ranks.
+    ReportSummary reduceReportSummary(const Opm::ConvergenceReport&      report,
+                                      const Opm::Parallel::Communication comm)
+    {
+        // MPI datatype and reduction operation, created on first use and
+        // released by MPI_Finalize().
+        static const auto typeAndOp = []()
+        {
+            auto type = MPI_Datatype {};
+            MPI_Type_contiguous(sizeof(ReportSummary), MPI_BYTE, &type);
+            MPI_Type_commit(&type);
+
+            auto op = MPI_Op {};
+            MPI_Op_create(&combineReportSummaries, /* commute = */ 1, &op);
+
+            return std::pair { type, op };
+        }();
+
+        auto summary = ReportSummary { report };
+        MPI_Allreduce(MPI_IN_PLACE, &summary, 1,
+                      typeAndOp.first, typeAndOp.second, comm);
+
+        return summary;
+    }
 } // Anonymous namespace
 
 namespace Opm
@@ -139,14 +222,44 @@ namespace Opm
     /// reports.
     ConvergenceReport
     gatherConvergenceReport(const ConvergenceReport& local_report,
-                            Parallel::Communication  mpi_communicator)
+                            Parallel::Communication  mpi_communicator,
+                            const bool               gatherDetails)
     {
         if (mpi_communicator.size() == 1) {
             // Sequential run, no communication needed.
             return local_report;
         }
 
-        // Multi-process run (common case).  Need object distribution.
+        // Multi-process run (common case).  Combine the fixed-size part of
+        // the reports first.  If all ranks converged, that is all we need,
+        // and we avoid gathering O(#ranks) variable-length reports in every
+        // Newton iteration.
+        const auto summary = reduceReportSummary(local_report, mpi_communicator);
+
+        // CNV pore-volume splits are equal on all ranks which have one, so
+        // the local one can be used unless only some of the ranks have it.
+        const auto localCnvPvSplit = (summary.numCnvPvSplits == 0)
+            || (summary.numCnvPvSplits == mpi_communicator.size());
+
+        if ((summary.status == ConvergenceReport::AllGood) &&
+            !gatherDetails && localCnvPvSplit)
+        {
+            auto combinedReport = ConvergenceReport { summary.reportTime };
+
+            combinedReport.setWellGroupTargetsViolated(summary.wellGroupTargetsViolated != 0);
+            combinedReport.setNetworkNotYetBalancedForceAnotherNewtonIteration
+                (summary.networkNotYetBalanced != 0);
+
+            if (summary.numCnvPvSplits > 0) {
+                combinedReport.setCnvPoreVolSplit(local_report.cnvPvSplit(),
+                                                  local_report.eligiblePoreVolume());
+            }
+
+            return combinedReport;
+        }
+
+        // Some rank failed to converge or details are requested.  Need
+        // object distribution.
         auto combinedReport = ConvergenceReport {};
 
         const auto packer = Mpi::Packer { mpi_communicator };
@@ -169,7 +282,8 @@ namespace Opm
 {
     ConvergenceReport
     gatherConvergenceReport(const ConvergenceReport& local_report,
-                            [[maybe_unused]] Parallel::Communication mpi_communicator)
+                            [[maybe_unused]] Parallel::Communication mpi_communicator,
+                            [[maybe_unused]] const bool gatherDetails)
     {
         return local_report;
     }
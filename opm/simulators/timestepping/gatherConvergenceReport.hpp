@@ -30,9 +30,16 @@ namespace Opm
 
     /// Create a global convergence report combining local
     /// (per-process) reports.
+    ///
+    /// The report time, status and flags are combined by a single
+    /// reduction.  The failures and convergence metrics of all processes
+    /// are only gathered if any process failed to converge, or if
+    /// \p gatherDetails is true.  Otherwise the combined report holds no
+    /// convergence metrics.
     ConvergenceReport
     gatherConvergenceReport(const ConvergenceReport& local_report,
-                            Parallel::Communication  communicator);
+                            Parallel::Communication  communicator,
+                            bool                     gatherDetails = false);
 
 } // namespace Opm
 
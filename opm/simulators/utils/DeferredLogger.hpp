@@ -88,6 +88,9 @@ enum ExcEnum {
         /// Clear the message container without logging them.
         void clearMessages();
 
+        /// Append all messages of another logger, keeping their order.
+        void append(const DeferredLogger& other);
+
     private:
         std::vector<Message> messages_;
         friend DeferredLogger gatherDeferredLogger(const DeferredLogger& local_deferredlogger,
@@ -0,0 +1,125 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_DEFERRED_REDUCTION_HPP
+#define OPM_DEFERRED_REDUCTION_HPP
+
+#include <opm/simulators/utils/ParallelCommunication.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace Opm {
+
+/// Global sums and maxima of many scalars, resolved with one collective
+/// operation per kind of reduction.
+///
+/// Callers first register their local contributions, then call reduce(),
+/// and finally read the global values through the handles returned at
+/// registration. Since reduce() is collective, all processes must register
+/// the same sequence of sums and maxima.
+template<class Scalar, class Comm = Parallel::Communication>
+class DeferredReduction
+{
+public:
+    /// Refers to a registered value.
+    class Handle
+    {
+    public:
+        Handle() = default;
+
+    private:
+        friend class DeferredReduction;
+
+        Handle(bool isMax, std::size_t index)
+            : isMax_(isMax), index_(index)
+        {}
+
+        bool isMax_ = false;
+        std::size_t index_ = 0;
+    };
+
+    explicit DeferredReduction(const Comm& comm)
+        : comm_(comm)
+    {}
+
+    /// Register a local contribution to a global sum.
+    Handle sum(const Scalar localValue)
+    {
+        assert(!reduced_);
+        sums_.push_back(localValue);
+        return {false, sums_.size() - 1};
+    }
+
+    /// Register a local contribution to a global maximum.
+    Handle max(const Scalar localValue)
+    {
+        assert(!reduced_);
+        maxima_.push_back(localValue);
+        return {true, maxima_.size() - 1};
+    }
+
+    /// Reduce all registered values over all processes.
+    void reduce()
+    {
+        assert(!reduced_);
+        if (!sums_.empty()) {
+            comm_.sum(sums_.data(), sums_.size());
+            ++numCollectives_;
+        }
+        if (!maxima_.empty()) {
+            comm_.max(maxima_.data(), maxima_.size());
+            ++numCollectives_;
+        }
+        reduced_ = true;
+    }
+
+    /// The global value of a registered contribution, after reduce().
+    Scalar operator[](const Handle& handle) const
+    {
+        assert(reduced_);
+        return handle.isMax_ ? maxima_[handle.index_] : sums_[handle.index_];
+    }
+
+    /// Forget all registered values, to start a new batch.
+    void clear()
+    {
+        sums_.clear();
+        maxima_.clear();
+        reduced_ = false;
+    }
+
+    /// The number of registered values.
+    std::size_t size() const
+    { return sums_.size() + maxima_.size(); }
+
+    /// The number of collective operations done so far.
+    std::size_t numCollectives() const
+    { return numCollectives_; }
+
+private:
+    const Comm& comm_;
+    std::vector<Scalar> sums_;
+    std::vector<Scalar> maxima_;
+    std::size_t numCollectives_ = 0;
+    bool reduced_ = false;
+};
+
+} // namespace Opm
+
+#endif // OPM_DEFERRED_REDUCTION_HPP
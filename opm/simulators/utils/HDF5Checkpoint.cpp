@@ -0,0 +1,168 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+#include <config.h>
+#include <opm/simulators/utils/HDF5Checkpoint.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+
+namespace Opm {
+
+CheckpointWriter::CheckpointWriter(const std::string& fileName,
+                                   Parallel::Communication comm,
+                                   bool async,
+                                   bool incremental)
+    : fileName_(fileName)
+    , comm_(comm)
+    , async_(async && comm.size() == 1)
+    , incremental_(incremental)
+{
+}
+
+CheckpointWriter::~CheckpointWriter()
+{
+    if (pending_.valid()) {
+        // Reached without wait() when the simulation is aborted, so the
+        // error cannot be rethrown here. Report it rather than losing it.
+        try {
+            pending_.get();
+        } catch (const std::exception& e) {
+            OpmLog::error("Error writing serialized state to " + fileName_ + ": " + e.what());
+        } catch (...) {
+            OpmLog::error("Unknown error writing serialized state to " + fileName_);
+        }
+    }
+}
+
+void CheckpointWriter::write(CheckpointSnapshot&& snapshot, bool newFile)
+{
+    this->wait();
+
+    if (async_) {
+        pending_ = std::async(std::launch::async,
+                              [this, datasets = std::move(snapshot.datasets()), newFile]() mutable
+                              { this->writeSnapshot(datasets, newFile); });
+    } else {
+        this->writeSnapshot(snapshot.datasets(), newFile);
+    }
+}
+
+void CheckpointWriter::wait()
+{
+    if (pending_.valid()) {
+        pending_.get();
+    }
+}
+
+void CheckpointWriter::writeSnapshot(std::vector<CheckpointSnapshot::Dataset>& datasets,
+                                     bool newFile)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    if (newFile) {
+        std::filesystem::remove(fileName_);
+        // Blocks can only be shared with checkpoints in the same file.
+        previous_.clear();
+    }
+
+    {
+        HDF5File file(fileName_, HDF5File::OpenMode::APPEND, comm_);
+        for (auto& dataset : datasets) {
+            if (incremental_ && dataset.mode == HDF5File::DataSetMode::PROCESS_SPLIT) {
+                this->writeIncremental(file, dataset);
+            } else {
+                file.write(dataset.group, dataset.name, dataset.buffer, dataset.mode);
+                bytesWritten_ += dataset.buffer.size();
+            }
+        }
+    }
+
+    writeTime_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void CheckpointWriter::writeIncremental(HDF5File& file,
+                                        CheckpointSnapshot::Dataset& dataset)
+{
+    const auto& buffer = dataset.buffer;
+    const std::size_t numBlocks = (buffer.size() + blockSize - 1) / blockSize;
+
+    const auto prevIt = previous_.find(dataset.name);
+    const Previous* prev = prevIt != previous_.end() ? &prevIt->second : nullptr;
+
+    HDF5BlockTable table;
+    table.blockSize = blockSize;
+    table.size = buffer.size();
+    table.blocks.resize(numBlocks);
+
+    // Map the groups of the previous table to the ones of the new table,
+    // which only keeps the groups that are still referenced.
+    std::vector<int> groupIndex(prev ? prev->table.groups.size() : 0, -1);
+    const int ownGroup = -2;
+
+    std::vector<char> delta;
+    for (std::size_t block = 0; block < numBlocks; ++block) {
+        const std::size_t begin = block * blockSize;
+        const std::size_t len = std::min(blockSize, buffer.size() - begin);
+        const bool unchanged = prev && prev->buffer.size() == buffer.size() &&
+                               std::memcmp(prev->buffer.data() + begin,
+                                           buffer.data() + begin, len) == 0;
+        if (unchanged) {
+            const auto& [group, offset] = prev->table.blocks[block];
+            if (groupIndex[group] < 0) {
+                groupIndex[group] = table.groups.size();
+                table.groups.push_back(prev->table.groups[group]);
+            }
+            table.blocks[block] = {groupIndex[group], offset};
+        } else {
+            table.blocks[block] = {ownGroup, delta.size()};
+            delta.insert(delta.end(), buffer.begin() + begin, buffer.begin() + begin + len);
+        }
+    }
+
+    if (!delta.empty() || table.groups.empty()) {
+        const int own = table.groups.size();
+        table.groups.push_back(dataset.group);
+        for (auto& entry : table.blocks) {
+            if (entry.first == ownGroup) {
+                entry.first = own;
+            }
+        }
+    }
+
+    // The delta dataset is written even when empty, since the parallel
+    // HDF5 driver needs all processes to create the same datasets.
+    file.write(dataset.group, dataset.name + HDF5BlockTable::deltaSuffix, delta);
+
+    CheckpointSnapshot tableSnapshot;
+    tableSnapshot.write(table, dataset.group, dataset.name + HDF5BlockTable::tableSuffix);
+    const auto& tableBuffer = tableSnapshot.datasets().front().buffer;
+    file.write(dataset.group, dataset.name + HDF5BlockTable::tableSuffix, tableBuffer);
+    bytesWritten_ += delta.size() + tableBuffer.size();
+
+    previous_[dataset.name] = Previous{std::move(dataset.buffer), std::move(table)};
+}
+
+}
@@ -0,0 +1,198 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+#ifndef HDF5_CHECKPOINT_HPP
+#define HDF5_CHECKPOINT_HPP
+
+#include <opm/common/utility/Serializer.hpp>
+
+#include <opm/simulators/utils/HDF5File.hpp>
+#include <opm/simulators/utils/ParallelCommunication.hpp>
+#include <opm/simulators/utils/SerializationPackers.hpp>
+
+#include <cstddef>
+#include <future>
+#include <limits>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+//! \brief Locations of the blocks of a dataset which is stored incrementally.
+//! \details The dataset is split into blocks of equal size. Each block is
+//!          stored in the "<name>_delta" dataset of one of the listed groups,
+//!          which is the group of the checkpoint where the block last changed.
+struct HDF5BlockTable {
+    std::size_t blockSize = 0; //!< Size of the blocks, the last block may be smaller
+    std::size_t size = 0; //!< Size of the dataset
+    std::vector<std::string> groups; //!< Groups holding the blocks
+    std::vector<std::pair<int, std::size_t>> blocks; //!< Group index and offset of each block
+
+    //! \brief Suffix of the dataset storing the block table.
+    static constexpr const char* tableSuffix = "_blocks";
+
+    //! \brief Suffix of the datasets storing the changed blocks.
+    static constexpr const char* deltaSuffix = "_delta";
+
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(blockSize);
+        serializer(size);
+        serializer(groups);
+        serializer(blocks);
+    }
+};
+
+//! \brief In-memory snapshot of the serialized datasets of a checkpoint.
+//! \details Offers the write interface of HDF5Serializer, but only packs the
+//!          data, such that the snapshot can be written while the simulation
+//!          continues.
+class CheckpointSnapshot : public Serializer<Serialization::MemPacker> {
+public:
+    //! \brief A packed dataset.
+    struct Dataset {
+        std::string group; //!< Group to write dataset to
+        std::string name; //!< Name of dataset
+        std::vector<char> buffer; //!< Packed data
+        HDF5File::DataSetMode mode; //!< Mode for dataset
+    };
+
+    CheckpointSnapshot()
+        : Serializer<Serialization::MemPacker>(m_packer_priv)
+    {}
+
+    //! \brief Serialize data into a dataset of the snapshot.
+    //! \tparam T Type of class to write
+    //! \param data Class to write restart data for
+    //! \param group Group to write dataset to
+    //! \param dset Data set to write
+    //! \param mode Mode for dataset
+    template<class T>
+    void write(T& data,
+               const std::string& group,
+               const std::string& dset,
+               HDF5File::DataSetMode mode = HDF5File::DataSetMode::PROCESS_SPLIT)
+    {
+        try {
+            this->pack(data);
+        } catch (...) {
+            m_packSize = std::numeric_limits<std::size_t>::max();
+            throw;
+        }
+
+        datasets_.push_back({group, dset, std::move(m_buffer), mode});
+    }
+
+    //! \brief Returns the packed datasets.
+    std::vector<Dataset>& datasets()
+    { return datasets_; }
+
+private:
+    const Serialization::MemPacker m_packer_priv{}; //!< Packer instance
+    std::vector<Dataset> datasets_; //!< Packed datasets
+};
+
+//! \brief Writes checkpoint snapshots to an HDF5 file.
+//! \details In asynchronous mode, a snapshot is written on a background
+//!          thread while the caller continues. Only one snapshot is in flight
+//!          at a time. Asynchronous writing needs a serial run, since the
+//!          parallel HDF5 driver performs collective MPI operations.
+//!
+//!          In incremental mode, the process-split datasets are stored as
+//!          blocks, and only the blocks which changed since the previous
+//!          checkpoint in the same file are written. HDF5Serializer::read()
+//!          reassembles such datasets.
+class CheckpointWriter {
+public:
+    //! \brief Constructor.
+    //! \param fileName Name of file to write to
+    //! \param comm Parallel communicator
+    //! \param async True to write on a background thread (serial runs only)
+    //! \param incremental True to only write blocks which changed
+    CheckpointWriter(const std::string& fileName,
+                     Parallel::Communication comm,
+                     bool async,
+                     bool incremental);
+
+    //! \brief Destructor waits for a pending write.
+    //! \details Errors of that write are logged, since they cannot be thrown.
+    ~CheckpointWriter();
+
+    CheckpointWriter(const CheckpointWriter&) = delete;
+    CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+    //! \brief Write a snapshot, after the previous one has been written.
+    //! \param snapshot Snapshot to write
+    //! \param newFile True to replace the file rather than appending to it
+    //! \details In asynchronous mode, this returns before the data is written.
+    void write(CheckpointSnapshot&& snapshot, bool newFile);
+
+    //! \brief Wait until the pending snapshot is written.
+    //! \details Rethrows an exception raised while writing it.
+    void wait();
+
+    //! \brief Returns whether snapshots are written on a background thread.
+    bool isAsync() const
+    { return async_; }
+
+    //! \brief Returns the time spent writing snapshots, in seconds.
+    //! \details Only up to date after wait().
+    double writeTime() const
+    { return writeTime_; }
+
+    //! \brief Returns the number of bytes of data written on this process.
+    //! \details Only up to date after wait().
+    std::size_t bytesWritten() const
+    { return bytesWritten_; }
+
+    //! \brief Size of the blocks of incrementally stored datasets.
+    static constexpr std::size_t blockSize = 64 * 1024;
+
+private:
+    //! \brief Previously written version of an incrementally stored dataset.
+    struct Previous {
+        std::vector<char> buffer; //!< Data of the previous checkpoint
+        HDF5BlockTable table; //!< Block locations of the previous checkpoint
+    };
+
+    //! \brief Write the datasets of a snapshot to file.
+    void writeSnapshot(std::vector<CheckpointSnapshot::Dataset>& datasets,
+                       bool newFile);
+
+    //! \brief Write a dataset as blocks, skipping unchanged ones.
+    void writeIncremental(HDF5File& file,
+                          CheckpointSnapshot::Dataset& dataset);
+
+    std::string fileName_; //!< Name of file to write to
+    Parallel::Communication comm_; //!< Parallel communicator
+    bool async_; //!< True to write on a background thread
+    bool incremental_; //!< True to only write changed blocks
+    std::map<std::string, Previous> previous_; //!< Previous datasets by name
+    std::future<void> pending_; //!< Pending asynchronous write
+    double writeTime_ = 0.0; //!< Time spent writing
+    std::size_t bytesWritten_ = 0; //!< Number of bytes written
+};
+
+}
+
+#endif // HDF5_CHECKPOINT_HPP
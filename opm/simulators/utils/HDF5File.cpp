@@ -26,6 +26,7 @@
 
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <filesystem>
@@ -33,6 +34,9 @@
 
 namespace {
 
+//! \brief Upper bound for the chunk size of compressed datasets.
+constexpr hsize_t maxChunkSize = 1024 * 1024;
+
 bool groupExists(hid_t parent, const std::string& path)
 {
   // turn off errors to avoid cout spew
@@ -169,9 +173,31 @@ void HDF5File::read(const std::string& group,
     hsize_t size = H5Sget_simple_extent_npoints(space);
     buffer.resize(size);
     H5Dread(dataset_id, H5T_NATIVE_CHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer.data());
+    H5Sclose(space);
     H5Dclose(dataset_id);
 }
 
+bool HDF5File::exists(const std::string& path) const
+{
+    // Links can only be checked once their parent is known to exist.
+    std::string current;
+    std::string::size_type pos = 0;
+    while (pos != std::string::npos) {
+        const auto next = path.find('/', pos);
+        const auto name = path.substr(pos, next == std::string::npos ? next : next - pos);
+        pos = next == std::string::npos ? next : next + 1;
+        if (name.empty()) {
+            continue;
+        }
+        current += '/' + name;
+        if (!groupExists(m_file, current)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 std::vector<std::string> HDF5File::list(const std::string& group) const
 {
     // Lambda function pushing the group entries to a vector
@@ -264,7 +290,9 @@ void HDF5File::writeRootOnly(hid_t grp,
                                   H5P_DEFAULT, dcpl, H5P_DEFAULT);
     if (dataset_id == H5I_INVALID_HID) {
         H5Sclose(space);
-        H5Pclose(dcpl);
+        if (dcpl != H5P_DEFAULT) {
+            H5Pclose(dcpl);
+        }
         throw std::runtime_error("Trying to write already existing dataset '" +
                                  group + '/' + dset + "'");
     }
@@ -272,6 +300,9 @@ void HDF5File::writeRootOnly(hid_t grp,
     writeDset(0, dataset_id, dxpl, size, buffer.data());
     H5Dclose(dataset_id);
     H5Sclose(space);
+    if (dcpl != H5P_DEFAULT) {
+        H5Pclose(dcpl);
+    }
     if (dxpl != H5P_DEFAULT) {
         H5Pclose(dxpl);
     }
@@ -281,10 +312,13 @@ hid_t HDF5File::getCompression([[maybe_unused]] hsize_t size) const
 {
     hid_t dcpl = H5P_DEFAULT;
 #if H5_VERS_MINOR > 8
-    if (H5Zfilter_avail(H5Z_FILTER_DEFLATE)) {
+    if (size > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE)) {
+        // Bounded chunks keep the memory used by the filter small and stay
+        // below the 4 GB limit on the chunk size for large datasets.
+        const hsize_t chunk = std::min(size, maxChunkSize);
         dcpl = H5Pcreate(H5P_DATASET_CREATE);
         H5Pset_deflate(dcpl, 1);
-        H5Pset_chunk(dcpl, 1, &size);
+        H5Pset_chunk(dcpl, 1, &chunk);
     }
 #endif
     return dcpl;
@@ -79,6 +79,10 @@ public:
               std::vector<char>& buffer,
               DataSetMode mode = DataSetMode::PROCESS_SPLIT) const;
 
+    //! \brief Returns whether a group or dataset exists.
+    //! \param path Absolute path of group or dataset
+    bool exists(const std::string& path) const;
+
     //! \brief Lists the entries in a given group.
     //! \details Note: Both datasets and subgroups are returned
     std::vector<std::string> list(const std::string& group) const;
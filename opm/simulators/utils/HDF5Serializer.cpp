@@ -21,8 +21,11 @@
 #include <config.h>
 #include <opm/simulators/utils/HDF5Serializer.hpp>
 
+#include <opm/simulators/utils/HDF5Checkpoint.hpp>
+
 #include <algorithm>
 #include <cstdlib>
+#include <stdexcept>
 
 namespace Opm {
 
@@ -66,4 +69,38 @@ std::vector<int> HDF5Serializer::reportSteps() const
     return result;
 }
 
+void HDF5Serializer::readBuffer(const std::string& group,
+                                const std::string& dset,
+                                HDF5File::DataSetMode mode)
+{
+    const std::string tableSet = dset + HDF5BlockTable::tableSuffix;
+    if (mode != HDF5File::DataSetMode::PROCESS_SPLIT ||
+        !m_h5file.exists(group + '/' + tableSet)) {
+        m_h5file.read(group, dset, m_buffer, mode);
+        return;
+    }
+
+    HDF5BlockTable table;
+    m_h5file.read(group, tableSet, m_buffer);
+    this->unpack(table);
+
+    std::vector<std::vector<char>> deltas(table.groups.size());
+    for (std::size_t i = 0; i < table.groups.size(); ++i) {
+        m_h5file.read(table.groups[i], dset + HDF5BlockTable::deltaSuffix, deltas[i]);
+    }
+
+    std::vector<char> data(table.size);
+    for (std::size_t block = 0; block < table.blocks.size(); ++block) {
+        const auto& [grp, offset] = table.blocks[block];
+        const std::size_t begin = block * table.blockSize;
+        const std::size_t len = std::min(table.blockSize, table.size - begin);
+        if (offset + len > deltas[grp].size()) {
+            throw std::runtime_error("Inconsistent block table for dataset " +
+                                     group + '/' + dset);
+        }
+        std::copy_n(deltas[grp].begin() + offset, len, data.begin() + begin);
+    }
+    m_buffer = std::move(data);
+}
+
 }
@@ -91,7 +91,7 @@ public:
               const std::string& dset,
               HDF5File::DataSetMode mode = HDF5File::DataSetMode::PROCESS_SPLIT)
     {
-        m_h5file.read(group, dset, m_buffer, mode);
+        this->readBuffer(group, dset, mode);
         this->unpack(data);
     }
 
@@ -102,6 +102,12 @@ public:
     std::vector<int> reportSteps() const;
 
 private:
+    //! \brief Read a dataset into the buffer.
+    //! \details Reassembles datasets stored incrementally by CheckpointWriter.
+    void readBuffer(const std::string& group,
+                    const std::string& dset,
+                    HDF5File::DataSetMode mode);
+
     const Serialization::MemPacker m_packer_priv{}; //!< Packer instance
     HDF5File m_h5file; //!< HDF5 backend for the serializer
 };
@@ -0,0 +1,53 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_REUSING_ASSIGN_HPP
+#define OPM_REUSING_ASSIGN_HPP
+
+#include <algorithm>
+#include <map>
+
+namespace Opm {
+
+/// Copy-assign the map other to map.
+///
+/// Plain copy-assignment of a std::map copy-constructs every value, so
+/// values owning memory, such as vectors, are reallocated on every copy.
+/// If both maps have the same keys, this instead assigns the values in
+/// place, which reuses their storage.
+template<class Key, class Value, class Compare, class Alloc>
+void reusingAssign(std::map<Key, Value, Compare, Alloc>& map,
+                   const std::map<Key, Value, Compare, Alloc>& other)
+{
+    const bool sameKeys =
+        map.size() == other.size() &&
+        std::equal(map.begin(), map.end(), other.begin(),
+                   [](const auto& a, const auto& b) { return a.first == b.first; });
+    if (!sameKeys) {
+        map = other;
+        return;
+    }
+
+    auto it = map.begin();
+    for (const auto& entry : other) {
+        (it++)->second = entry.second;
+    }
+}
+
+} // namespace Opm
+
+#endif // OPM_REUSING_ASSIGN_HPP
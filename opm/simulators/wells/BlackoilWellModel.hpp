@@ -259,9 +259,11 @@ template<class Scalar> class WellContributions;
 
             void addWellContributions(SparseMatrixAdapter& jacobian) const;
 
-            // add source from wells to the reservoir matrix
+            // add source from wells to the reservoir matrix, for the cells
+            // flagged in interior (all cells if interior is empty)
             void addReservoirSourceTerms(GlobalEqVector& residual,
-                                         const std::vector<typename SparseMatrixAdapter::MatrixBlock*>& diagMatAddress) const;
+                                         const std::vector<typename SparseMatrixAdapter::MatrixBlock*>& diagMatAddress,
+                                         const std::vector<bool>& interior = {}) const;
 
             // called at the beginning of a report step
             void beginReportStep(const int time_step);
@@ -329,6 +331,23 @@ template<class Scalar> class WellContributions;
                 return nldd_->well_domain();
             }
 
+            /// \brief Whether the wells are assembled and applied, and their
+            /// potentials computed, using multiple threads
+            bool useThreadedWells() const;
+
+            /// \brief Groups of local wells, given as indices into localNonshutWells(),
+            /// which do not share any perforated cell.
+            /// \details Only used with threaded wells. Wells distributed over several
+            /// processes are not part of any group, see serialWells().
+            const std::vector<std::vector<int>>& threadedWellGroups() const
+            { return threaded_well_groups_; }
+
+            /// \brief Local wells distributed over several processes
+            /// \details These wells communicate during assembly and application and
+            /// are therefore always processed serially, in container order.
+            const std::vector<int>& serialWells() const
+            { return serial_wells_; }
+
             auto begin() const { return well_container_.begin(); }
             auto end() const { return well_container_.end(); }
             bool empty() const { return well_container_.empty(); }
@@ -354,7 +373,7 @@ template<class Scalar> class WellContributions;
             void recoverWellSolutionAndUpdateWellState(const BVector& x);
 
             // using the solution x to recover the solution xw for wells and applying
-            // xw to update Well State
+            // xw to update Well State. x is indexed by the domain-local cell index.
             void recoverWellSolutionAndUpdateWellStateDomain(const BVector& x,
                                                              const int domainIdx);
             // Update cellRates_ with contributions from all wells
@@ -455,6 +474,8 @@ template<class Scalar> class WellContributions;
             // TODO: finding a better naming
             void assembleWellEqWithoutIteration(const double dt);
 
+            void assembleWellEqWithoutIterationThreaded(const double dt);
+
             const std::vector<Scalar>& B_avg() const
             { return B_avg_; }
 
@@ -575,11 +596,25 @@ template<class Scalar> class WellContributions;
 
             void updateAverageFormationFactor();
 
-            void computePotentials(const std::size_t widx,
+            void computePotentials(const std::vector<std::size_t>& well_indices,
                                    const WellState<Scalar, IndexTraits>& well_state_copy,
                                    std::string& exc_msg,
                                    ExceptionType::ExcEnum& exc_type) override;
 
+            void computePotentialsThreaded(const std::vector<std::size_t>& well_indices,
+                                           const WellState<Scalar, IndexTraits>& well_state_copy,
+                                           std::string& exc_msg,
+                                           ExceptionType::ExcEnum& exc_type);
+
+            void computeSingleWellPotentials(const std::size_t widx,
+                                             const WellState<Scalar, IndexTraits>& well_state_copy,
+                                             std::vector<Scalar>& potentials,
+                                             std::string& exc_msg,
+                                             ExceptionType::ExcEnum& exc_type);
+
+            void storeWellPotentials(const std::size_t widx,
+                                     const std::vector<Scalar>& potentials);
+
             const std::vector<Scalar>& wellPerfEfficiencyFactors() const;
 
             void calculateProductivityIndexValuesShutWells(const int reportStepIdx, DeferredLogger& deferred_logger) override;
@@ -616,6 +651,9 @@ template<class Scalar> class WellContributions;
 
             void computeWellTemperature();
 
+            // Set up threadedWellGroups() and serialWells() for the current well container.
+            void setupThreadedWellGroups();
+
         private:
             BlackoilWellModelGasLift<TypeTag> gaslift_;
             BlackoilWellModelNetwork<TypeTag> network_;
@@ -630,6 +668,11 @@ template<class Scalar> class WellContributions;
             // Store cell rates after assembling to avoid iterating all wells and connections for every element
             std::map<int, RateVector> cellRates_;
 
+            // Wells which can be processed concurrently, see threadedWellGroups()
+            std::vector<std::vector<int>> threaded_well_groups_;
+            // Distributed wells, see serialWells()
+            std::vector<int> serial_wells_;
+
             void assignWellTracerRates(data::Wells& wsrpt) const;
             void assignWellSpeciesRates(data::Wells& wsrpt) const;
 
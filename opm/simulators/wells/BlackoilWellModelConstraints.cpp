@@ -29,6 +29,8 @@
 
 #include <opm/material/fluidsystems/BlackOilDefaultFluidSystemIndices.hpp>
 
+#include <opm/simulators/utils/DeferredReduction.hpp>
+
 #include <opm/simulators/wells/BlackoilWellModelGeneric.hpp>
 #include <opm/simulators/wells/WellInterfaceGeneric.hpp>
 
@@ -57,120 +59,96 @@ checkGroupInjectionConstraints(const Group& group,
     else
         OPM_THROW(std::runtime_error, "Unknown phase" );
 
-    auto currentControl = wellModel_.groupState().injection_control(group.name(), phase);
-    if (group.has_control(phase, Group::InjectionCMode::RATE))
+    const auto currentControl = wellModel_.groupState().injection_control(group.name(), phase);
+    const auto isChecked = [&group, &phase, currentControl](const Group::InjectionCMode cmode)
     {
-        if (currentControl != Group::InjectionCMode::RATE)
-        {
-            Scalar current_rate = 0.0;
-            current_rate += groupStateHelper().sumWellSurfaceRates(group, phasePos, /*isInjector*/true);
+        return group.has_control(phase, cmode) && currentControl != cmode;
+    };
+    const bool checkRate = isChecked(Group::InjectionCMode::RATE);
+    const bool checkResv = isChecked(Group::InjectionCMode::RESV);
+    const bool checkRein = isChecked(Group::InjectionCMode::REIN);
+    const bool checkVrep = isChecked(Group::InjectionCMode::VREP);
+    if (!checkRate && !checkResv && !checkRein && !checkVrep) {
+        return std::make_pair(Group::InjectionCMode::NONE, 1.0);
+    }
 
-            // sum over all nodes
-            current_rate = wellModel_.comm().sum(current_rate);
+    // Sum the rates of all constraints to check over all nodes at once.
+    const auto& controls = group.injectionControls(phase, wellModel_.summaryState());
+    DeferredReduction<Scalar> rates(wellModel_.comm());
+    typename DeferredReduction<Scalar>::Handle surfaceRate, resvRate, reinProductionRate, voidageRate, totalRate;
+    if (checkRate || checkRein) {
+        surfaceRate = rates.sum(groupStateHelper().sumWellSurfaceRates(group, phasePos, /*isInjector*/true));
+    }
+    if (checkResv) {
+        resvRate = rates.sum(groupStateHelper().sumWellResRates(group, phasePos, /*is_injector=*/true));
+    }
+    if (checkRein) {
+        const Group& groupRein = wellModel_.schedule().getGroup(controls.reinj_group, reportStepIdx);
+        reinProductionRate = rates.sum(groupStateHelper().sumWellSurfaceRates(groupRein, phasePos,
+                                                                              /*is_injector=*/false));
+    }
+    if (checkVrep) {
+        const Group& groupVoidage = wellModel_.schedule().getGroup(controls.voidage_group, reportStepIdx);
+        Scalar voidage_rate = 0.0;
+        Scalar total_rate = 0.0;
+        for (const auto phaseIdx : {waterPhaseIdx, oilPhaseIdx, gasPhaseIdx}) {
+            const int pos = pu.canonicalToActivePhaseIdx(phaseIdx);
+            voidage_rate += groupStateHelper().sumWellResRates(groupVoidage, pos, /*is_injector=*/false);
+            total_rate += groupStateHelper().sumWellResRates(group, pos, /*is_injector=*/true);
+        }
+        voidageRate = rates.sum(voidage_rate);
+        totalRate = rates.sum(total_rate);
+    }
+    rates.reduce();
 
-            const auto& controls = group.injectionControls(phase, wellModel_.summaryState());
-            Scalar target = controls.surface_max_rate;
+    if (checkRate) {
+        const Scalar current_rate = rates[surfaceRate];
+        Scalar target = controls.surface_max_rate;
 
-            if (group.has_gpmaint_control(phase, Group::InjectionCMode::RATE))
-                target = wellModel_.groupState().gpmaint_target(group.name());
+        if (group.has_gpmaint_control(phase, Group::InjectionCMode::RATE))
+            target = wellModel_.groupState().gpmaint_target(group.name());
 
-            if (target < current_rate) {
-                Scalar scale = 1.0;
-                if (current_rate > 1e-12)
-                    scale = target / current_rate;
-                return std::make_pair(Group::InjectionCMode::RATE, scale);
-            }
+        if (target < current_rate) {
+            Scalar scale = 1.0;
+            if (current_rate > 1e-12)
+                scale = target / current_rate;
+            return std::make_pair(Group::InjectionCMode::RATE, scale);
         }
     }
-    if (group.has_control(phase, Group::InjectionCMode::RESV))
-    {
-        if (currentControl != Group::InjectionCMode::RESV)
-        {
-            Scalar current_rate = 0.0;
-            current_rate += groupStateHelper().sumWellResRates(group, phasePos, /*is_injector=*/true);
-            // sum over all nodes
-            current_rate = wellModel_.comm().sum(current_rate);
-
-            const auto& controls = group.injectionControls(phase, wellModel_.summaryState());
-            Scalar target = controls.resv_max_rate;
-
-            if (group.has_gpmaint_control(phase, Group::InjectionCMode::RESV))
-                target = wellModel_.groupState().gpmaint_target(group.name());
-
-            if (target < current_rate) {
-                Scalar scale = 1.0;
-                if (current_rate > 1e-12)
-                    scale = target / current_rate;
-                return std::make_pair(Group::InjectionCMode::RESV, scale);
-            }
+    if (checkResv) {
+        const Scalar current_rate = rates[resvRate];
+        Scalar target = controls.resv_max_rate;
+
+        if (group.has_gpmaint_control(phase, Group::InjectionCMode::RESV))
+            target = wellModel_.groupState().gpmaint_target(group.name());
+
+        if (target < current_rate) {
+            Scalar scale = 1.0;
+            if (current_rate > 1e-12)
+                scale = target / current_rate;
+            return std::make_pair(Group::InjectionCMode::RESV, scale);
         }
     }
-    if (group.has_control(phase, Group::InjectionCMode::REIN))
-    {
-        if (currentControl != Group::InjectionCMode::REIN)
-        {
-            Scalar production_Rate = 0.0;
-            const auto& controls = group.injectionControls(phase, wellModel_.summaryState());
-            const Group& groupRein = wellModel_.schedule().getGroup(controls.reinj_group, reportStepIdx);
-            production_Rate += groupStateHelper().sumWellSurfaceRates(groupRein, phasePos, /*is_injector=*/false);
-
-            // sum over all nodes
-            production_Rate = wellModel_.comm().sum(production_Rate);
-
-            Scalar current_rate = 0.0;
-            current_rate += groupStateHelper().sumWellSurfaceRates(group, phasePos, /*is_injector=*/true);
-
-            // sum over all nodes
-            current_rate = wellModel_.comm().sum(current_rate);
-
-            if (controls.target_reinj_fraction*production_Rate < current_rate) {
-                Scalar scale = 1.0;
-                if (current_rate > 1e-12)
-                    scale = controls.target_reinj_fraction*production_Rate / current_rate;
-                return std::make_pair(Group::InjectionCMode::REIN, scale);
-            }
+    if (checkRein) {
+        const Scalar production_Rate = rates[reinProductionRate];
+        const Scalar current_rate = rates[surfaceRate];
+
+        if (controls.target_reinj_fraction*production_Rate < current_rate) {
+            Scalar scale = 1.0;
+            if (current_rate > 1e-12)
+                scale = controls.target_reinj_fraction*production_Rate / current_rate;
+            return std::make_pair(Group::InjectionCMode::REIN, scale);
         }
     }
-    if (group.has_control(phase, Group::InjectionCMode::VREP))
-    {
-        if (currentControl != Group::InjectionCMode::VREP)
-        {
-            Scalar voidage_rate = 0.0;
-            const auto& controls = group.injectionControls(phase, wellModel_.summaryState());
-            const Group& groupVoidage = wellModel_.schedule().getGroup(controls.voidage_group, reportStepIdx);
-            voidage_rate += groupStateHelper().sumWellResRates(groupVoidage,
-                                                       pu.canonicalToActivePhaseIdx(waterPhaseIdx),
-                                                       /*is_injector=*/false);
-            voidage_rate += groupStateHelper().sumWellResRates(groupVoidage,
-                                                       pu.canonicalToActivePhaseIdx(oilPhaseIdx),
-                                                       /*is_injector=*/false);
-            voidage_rate += groupStateHelper().sumWellResRates(groupVoidage,
-                                                       pu.canonicalToActivePhaseIdx(gasPhaseIdx),
-                                                       /*is_injector=*/false);
-
-            // sum over all nodes
-            voidage_rate = wellModel_.comm().sum(voidage_rate);
-
-            Scalar total_rate = 0.0;
-            total_rate += groupStateHelper().sumWellResRates(group,
-                                                     pu.canonicalToActivePhaseIdx(waterPhaseIdx),
-                                                     /*is_injector=*/true);
-            total_rate += groupStateHelper().sumWellResRates(group,
-                                                     pu.canonicalToActivePhaseIdx(oilPhaseIdx),
-                                                     /*is_injector=*/true);
-            total_rate += groupStateHelper().sumWellResRates(group,
-                                                     pu.canonicalToActivePhaseIdx(gasPhaseIdx),
-                                                     /*is_injector=*/true);
-
-            // sum over all nodes
-            total_rate = wellModel_.comm().sum(total_rate);
-
-            if (controls.target_void_fraction*voidage_rate < total_rate) {
-                Scalar scale = 1.0;
-                if (total_rate > 1e-12)
-                    scale = controls.target_void_fraction*voidage_rate / total_rate;
-                return std::make_pair(Group::InjectionCMode::VREP, scale);
-            }
+    if (checkVrep) {
+        const Scalar voidage_rate = rates[voidageRate];
+        const Scalar total_rate = rates[totalRate];
+
+        if (controls.target_void_fraction*voidage_rate < total_rate) {
+            Scalar scale = 1.0;
+            if (total_rate > 1e-12)
+                scale = controls.target_void_fraction*voidage_rate / total_rate;
+            return std::make_pair(Group::InjectionCMode::VREP, scale);
         }
     }
     return std::make_pair(Group::InjectionCMode::NONE, 1.0);
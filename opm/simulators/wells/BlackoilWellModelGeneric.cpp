@@ -55,6 +55,7 @@
 #include <opm/material/fluidsystems/BlackOilDefaultFluidSystemIndices.hpp>
 
 #include <opm/simulators/utils/DeferredLogger.hpp>
+#include <opm/simulators/utils/DeferredReduction.hpp>
 #include <opm/simulators/wells/BlackoilWellModelConstraints.hpp>
 #include <opm/simulators/wells/BlackoilWellModelGasLift.hpp>
 #include <opm/simulators/wells/BlackoilWellModelGuideRates.hpp>
@@ -74,6 +75,7 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <functional>
 #include <iterator>
@@ -496,8 +498,10 @@ checkGconsaleLimits(const Group& group,
         group, gasPos, /*is_injector=*/true
     );
     // sum over all nodes
-    injection_rate = comm_.sum(injection_rate);
-    production_rate = comm_.sum(production_rate);
+    std::array rates = {injection_rate, production_rate};
+    comm_.sum(rates.data(), rates.size());
+    injection_rate = rates[0];
+    production_rate = rates[1];
 
     Scalar sales_rate = production_rate - injection_rate;
     Scalar production_target = gconsale.sales_target + injection_rate;
@@ -974,8 +978,10 @@ updateWsolvent(const Group& group,
             groupRein, /*is_injector=*/false
         );
 
-        solventProductionRate = comm_.sum(solventProductionRate);
-        gasProductionRate = comm_.sum(gasProductionRate);
+        std::array rates = {solventProductionRate, gasProductionRate};
+        comm_.sum(rates.data(), rates.size());
+        solventProductionRate = rates[0];
+        gasProductionRate = rates[1];
 
         Scalar wsolvent = 0.0;
         if (std::abs(gasProductionRate) > 1e-6)
@@ -1243,6 +1249,17 @@ updateAndCommunicateGroupData(const int reportStepIdx,
         OPM_TIMEBLOCK(updateNupcol);
         this->updateNupcolWGState();
     } else {
+        // Sum the production rates of the groups under VREP or REIN control, in
+        // the NUPCOL and the current well state, over all nodes at once.
+        struct GroupRates
+        {
+            std::string name;
+            bool is_vrep;
+            typename DeferredReduction<Scalar>::Handle nupcol_rate;
+            typename DeferredReduction<Scalar>::Handle rate;
+        };
+        DeferredReduction<Scalar> rates(comm_);
+        std::vector<GroupRates> group_rates;
         for (const auto& gr_name : schedule().groupNames(reportStepIdx)) {
             const Phase all[] = { Phase::WATER, Phase::OIL, Phase::GAS };
             for (Phase phase : all) {
@@ -1276,27 +1293,35 @@ updateAndCommunicateGroupData(const int reportStepIdx,
                                 /*is_injector=*/false
                             );
                         }
-                        // sum contributions from owned wells to everybody
-                        gr_rate_nupcol = comm_.sum(gr_rate_nupcol);
-                        gr_rate = comm_.sum(gr_rate);
-
-                        Scalar small_rate = 1e-12; // m3/s
-                        Scalar denominator = (0.5*gr_rate_nupcol + 0.5*gr_rate);
-                        Scalar rel_change = denominator > small_rate ? std::abs( (gr_rate_nupcol - gr_rate) / denominator) : 0.0;
-                        if ( rel_change > tol_nupcol) {
-                            this->updateNupcolWGState();
-                            if (comm_.rank() == 0) {
-                                const std::string control_str = is_vrep? "VREP" : "REIN";
-                                const std::string msg = fmt::format("Group prodution relative change {} larger than tolerance {} "
-                                                        "at iteration {}. Update {} for Group {} even if iteration is larger than {} given by NUPCOL." ,
-                                                        rel_change, tol_nupcol, iterCtx.iteration(), control_str, gr_name, nupcol);
-                                group_state_helper.deferredLogger().debug(msg);
-                            }
-                        }
+                        group_rates.push_back({gr_name, is_vrep,
+                                               rates.sum(gr_rate_nupcol), rates.sum(gr_rate)});
                     }
                 }
             }
         }
+        // sum contributions from owned wells to everybody
+        rates.reduce();
+
+        for (const auto& gr : group_rates) {
+            const Scalar gr_rate_nupcol = rates[gr.nupcol_rate];
+            const Scalar gr_rate = rates[gr.rate];
+            Scalar small_rate = 1e-12; // m3/s
+            Scalar denominator = (0.5*gr_rate_nupcol + 0.5*gr_rate);
+            Scalar rel_change = denominator > small_rate ? std::abs( (gr_rate_nupcol - gr_rate) / denominator) : 0.0;
+            if ( rel_change > tol_nupcol) {
+                this->updateNupcolWGState();
+                if (comm_.rank() == 0) {
+                    const std::string control_str = gr.is_vrep? "VREP" : "REIN";
+                    const std::string msg = fmt::format("Group prodution relative change {} larger than tolerance {} "
+                                            "at iteration {}. Update {} for Group {} even if iteration is larger than {} given by NUPCOL." ,
+                                            rel_change, tol_nupcol, iterCtx.iteration(), control_str, gr.name, nupcol);
+                    group_state_helper.deferredLogger().debug(msg);
+                }
+                // The NUPCOL state now equals the current state, so the
+                // relative changes of the remaining groups are zero.
+                break;
+            }
+        }
     }
     {
         constexpr int num_configs = 4;
@@ -1546,8 +1571,7 @@ updateWellPotentials(const int reportStepIdx,
     auto well_state_copy = this->wellState();
 
     const bool write_restart_file = schedule().write_rst_file(reportStepIdx);
-    auto exc_type = ExceptionType::NONE;
-    std::string exc_msg;
+    std::vector<std::size_t> potential_wells;
     std::size_t widx = 0;
     for (const auto& well : well_container_generic_) {
         const bool needed_for_summary =
@@ -1588,10 +1612,13 @@ updateWellPotentials(const int reportStepIdx,
         const bool compute_potential = needPotentialsForOutput || needPotentialsForGuideRates;
         if (compute_potential)
         {
-            this->computePotentials(widx, well_state_copy, exc_msg, exc_type);
+            potential_wells.push_back(widx);
         }
         ++widx;
     }
+    auto exc_type = ExceptionType::NONE;
+    std::string exc_msg;
+    this->computePotentials(potential_wells, well_state_copy, exc_msg, exc_type);
     logAndCheckForProblemsAndThrow(deferred_logger, exc_type,
                                    "updateWellPotentials() failed: " + exc_msg,
                                    terminal_output_, comm_);
@@ -455,7 +455,7 @@ protected:
 
     void setRepRadiusPerfLength();
 
-    virtual void computePotentials(const std::size_t widx,
+    virtual void computePotentials(const std::vector<std::size_t>& well_indices,
                                    const WellState<Scalar, IndexTraits>& well_state_copy,
                                    std::string& exc_msg,
                                    ExceptionType::ExcEnum& exc_type) = 0;
@@ -115,7 +115,7 @@ public:
                                          DeferredLogger& local_deferredLogger) const;
 
     // using the solution x to recover the solution xw for wells and applying
-    // xw to update Well State
+    // xw to update Well State. x is indexed by the domain-local cell index.
     void recoverWellSolutionAndUpdateWellState(const BVector& x,
                                                const int domainIdx);
 
@@ -30,6 +30,7 @@
 #endif
 
 #include <algorithm>
+#include <cstddef>
 
 namespace Opm {
 
@@ -152,19 +153,22 @@ recoverWellSolutionAndUpdateWellState(const BVector& x,
     // parallel but for each individual domain of each rank.
     // Use do_mpi_gather=false to avoid MPI collective operations.
     auto loggerGuard = wellModel_.groupStateHelper().pushLogger(/*do_mpi_gather=*/false);
+    std::size_t well_index = 0;
     for (const auto& well : wellModel_.localNonshutWells()) {
         if (this->well_domain().at(well->name()) == domainIdx) {
-            const auto& cells = well->cells();
-            x_local_.resize(cells.size());
+            // x is indexed by the domain-local cell index
+            const auto& local_cells = this->well_local_cells()[well_index];
+            x_local_.resize(local_cells.size());
 
-            for (size_t i = 0; i < cells.size(); ++i) {
-                x_local_[i] = x[cells[i]];
+            for (std::size_t i = 0; i < local_cells.size(); ++i) {
+                x_local_[i] = x[local_cells[i]];
             }
             well->recoverWellSolutionAndUpdateWellState(wellModel_.simulator(),
                                                         x_local_,
                                                         wellModel_.groupStateHelper(),
                                                         wellModel_.wellState());
         }
+        ++well_index;
     }
 }
 
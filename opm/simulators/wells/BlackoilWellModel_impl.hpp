@@ -40,6 +40,8 @@
 
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include <opm/models/parallel/threadmanager.hpp>
+
 #include <opm/simulators/wells/BlackoilWellModelConstraints.hpp>
 #include <opm/simulators/wells/BlackoilWellModelNldd.hpp>
 #include <opm/simulators/wells/GuideRateHandler.hpp>
@@ -47,6 +49,7 @@
 #include <opm/simulators/wells/ParallelWBPCalculation.hpp>
 #include <opm/simulators/wells/VFPProperties.hpp>
 #include <opm/simulators/wells/GroupStateHelper.hpp>
+#include <opm/simulators/wells/WellColoring.hpp>
 
 #ifdef RESERVOIR_COUPLING_ENABLED
 #include <opm/simulators/wells/rescoup/RescoupReceiveGroupConstraints.hpp>
@@ -67,6 +70,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <exception>
 #include <iomanip>
 #include <optional>
 #include <utility>
@@ -554,6 +558,13 @@ namespace Opm {
             if (this->reservoirCouplingMaster().isFirstSubstepOfSyncTimestep()) {
                 this->sendMasterGroupConstraintsToSlaves();
                 this->receiveSlaveGroupData();
+                // The slaves send their end-of-sync-step data while the master
+                // computes its first substep. Post the receives for it now, such
+                // that rescoupSyncSummaryData() only waits for slaves which are
+                // not done yet.
+                if (this->reservoirCouplingMaster().needsSlaveDataReceive()) {
+                    this->reservoirCouplingMaster().postReceiveDataFromSlaves();
+                }
             }
         }
 #endif
@@ -657,8 +668,9 @@ namespace Opm {
         // subsequent master substeps have correct slave production rates.
         //
         // Slave side: on the last substep of the sync step, the slave sends its
-        // production data to the master.  The master is already waiting at this
-        // point (blocked on MPI_Recv from its first substep's timeStepSucceeded).
+        // production data to the master.  The master posted the receives for it
+        // in beginTimeStep() of its first substep, and completes them here in the
+        // order the slaves finish.
         if (this->isReservoirCouplingMaster()) {
             if (this->reservoirCouplingMaster().needsSlaveDataReceive()) {
                 this->receiveSlaveGroupData();
@@ -1120,6 +1132,55 @@ namespace Opm {
         this->network_.initialize(report_step);
 
         this->wbp_.registerOpenWellsForWBPCalculation();
+
+        this->setupThreadedWellGroups();
+    }
+
+
+
+    template <typename TypeTag>
+    bool
+    BlackoilWellModel<TypeTag>::
+    useThreadedWells() const
+    {
+#ifdef _OPENMP
+        return param_.threaded_wells_ && ThreadManager::maxThreads() > 1;
+#else
+        return false;
+#endif
+    }
+
+
+
+    template <typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::
+    setupThreadedWellGroups()
+    {
+        threaded_well_groups_.clear();
+        serial_wells_.clear();
+        if (!this->useThreadedWells()) {
+            return;
+        }
+
+        std::vector<int> threaded_wells;
+        std::vector<std::vector<int>> well_cells;
+        for (std::size_t w = 0; w < well_container_.size(); ++w) {
+            const auto& well = well_container_[w];
+            if (well->parallelWellInfo().communication().size() > 1) {
+                serial_wells_.push_back(w);
+            } else {
+                threaded_wells.push_back(w);
+                well_cells.push_back(well->cells());
+            }
+        }
+
+        threaded_well_groups_ = groupWellsByDisjointCells(well_cells);
+        for (auto& group : threaded_well_groups_) {
+            for (auto& w : group) {
+                w = threaded_wells[w];
+            }
+        }
     }
 
 
@@ -1400,6 +1461,9 @@ namespace Opm {
     assembleWellEq(const double dt)
     {
         OPM_TIMEFUNCTION();
+        // Always serial, also with threaded wells: the inner well iterations
+        // switch well controls which the group targets of the other wells read
+        // from the shared well state, and they copy the whole well state.
         for (auto& well : well_container_) {
             well->assembleWellEq(simulator_, dt, this->groupStateHelper(), this->wellState());
         }
@@ -1431,15 +1495,75 @@ namespace Opm {
         // on one of them (WetGasPvt::saturationPressure might throw if not converged)
         OPM_BEGIN_PARALLEL_TRY_CATCH();
 
-        for (auto& well: well_container_) {
-            well->assembleWellEqWithoutIteration(simulator_, this->groupStateHelper(), dt, this->wellState(),
-                                                 /*solving_with_zero_rate=*/false);
+        if (this->useThreadedWells()) {
+            assembleWellEqWithoutIterationThreaded(dt);
+        } else {
+            for (auto& well: well_container_) {
+                well->assembleWellEqWithoutIteration(simulator_, this->groupStateHelper(), dt, this->wellState(),
+                                                     /*solving_with_zero_rate=*/false);
+            }
         }
         OPM_END_PARALLEL_TRY_CATCH_LOG(deferred_logger, "BlackoilWellModel::assembleWellEqWithoutIteration failed: ",
                                        this->terminal_output_, grid().comm());
 
     }
 
+    template<typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::
+    assembleWellEqWithoutIterationThreaded(const double dt)
+    {
+        OPM_TIMEFUNCTION();
+        // A well only writes to its own well state entry and linear system, so
+        // all wells that are not distributed can be assembled concurrently.
+        // Every well logs to its own logger; the loggers are appended in well
+        // order afterwards to keep the output independent of the scheduling.
+        const int num_wells = well_container_.size();
+        std::vector<DeferredLogger> well_loggers(num_wells);
+        std::vector<std::exception_ptr> well_exceptions(num_wells);
+
+        const auto assembleWell = [&](const int w)
+        {
+            try {
+                auto logger_guard = this->groupStateHelper().redirectLogger(well_loggers[w]);
+                well_container_[w]->assembleWellEqWithoutIteration(simulator_, this->groupStateHelper(), dt,
+                                                                   this->wellState(),
+                                                                   /*solving_with_zero_rate=*/false);
+            }
+            catch (...) {
+                well_exceptions[w] = std::current_exception();
+            }
+        };
+
+        for (const auto& group : threaded_well_groups_) {
+            const int num_group_wells = group.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+            for (int i = 0; i < num_group_wells; ++i) {
+                assembleWell(group[i]);
+            }
+        }
+
+        // Distributed wells communicate during assembly.
+        for (const int w : serial_wells_) {
+            assembleWell(w);
+            if (well_exceptions[w]) {
+                break;
+            }
+        }
+
+        auto& deferred_logger = this->groupStateHelper().deferredLogger();
+        for (const auto& logger : well_loggers) {
+            deferred_logger.append(logger);
+        }
+        for (const auto& exception : well_exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+    }
+
     template<typename TypeTag>
     void
     BlackoilWellModel<TypeTag>::
@@ -1448,6 +1572,12 @@ namespace Opm {
         // Pre-compute cell rates for all wells
         cellRates_.clear();
         for (const auto& well : well_container_) {
+            // Register all perforated cells, also for wells that are not
+            // solvable, such that the domain-local updates below never
+            // need to insert new entries.
+            for (const auto cellIdx : well->cells()) {
+                cellRates_.try_emplace(cellIdx, 0.0);
+            }
             well->addCellRates(cellRates_);
         }
     }
@@ -1457,11 +1587,25 @@ namespace Opm {
     BlackoilWellModel<TypeTag>::
     updateCellRatesForDomain(int domainIndex, const std::map<std::string, int>& well_domain_map)
     {
-        // Pre-compute cell rates only for wells in the specified domain
-        cellRates_.clear();
-        for (const auto& well : well_container_) {
+        // Re-compute cell rates only for wells in the specified domain.
+        // Entries of other domains are left as they are: they are not read
+        // when linearizing this domain, and keeping the structure of the map
+        // unchanged allows domains to be updated concurrently (a well never
+        // spans more than one domain).
+        auto inDomain = [&well_domain_map, domainIndex](const auto& well)
+        {
             const auto it = well_domain_map.find(well->name());
-            if (it != well_domain_map.end() && it->second == domainIndex) {
+            return it != well_domain_map.end() && it->second == domainIndex;
+        };
+        for (const auto& well : well_container_) {
+            if (inDomain(well)) {
+                for (const auto cellIdx : well->cells()) {
+                    cellRates_.insert_or_assign(cellIdx, RateVector(0.0));
+                }
+            }
+        }
+        for (const auto& well : well_container_) {
+            if (inDomain(well)) {
                 well->addCellRates(cellRates_);
             }
         }
@@ -1541,7 +1685,8 @@ namespace Opm {
     template <typename TypeTag>
     void BlackoilWellModel<TypeTag>::
     addReservoirSourceTerms(GlobalEqVector& residual,
-                            const std::vector<typename SparseMatrixAdapter::MatrixBlock*>& diagMatAddress) const
+                            const std::vector<typename SparseMatrixAdapter::MatrixBlock*>& diagMatAddress,
+                            const std::vector<bool>& interior) const
     {
         // NB this loop may write multiple times to the same element
         // if a cell is perforated by more than one well, so it should
@@ -1554,6 +1699,9 @@ namespace Opm {
             const auto& rates = well->connectionRates();
             for (unsigned perfIdx = 0; perfIdx < rates.size(); ++perfIdx) {
                 unsigned cellIdx = cells[perfIdx];
+                if (!interior.empty() && !interior[cellIdx]) {
+                    continue;
+                }
                 auto rate = rates[perfIdx];
                 rate *= -1.0;
                 VectorBlockType res(0.0);
@@ -1926,14 +2074,91 @@ namespace Opm {
 
     template<typename TypeTag>
     void
-    BlackoilWellModel<TypeTag>::computePotentials(const std::size_t widx,
+    BlackoilWellModel<TypeTag>::computePotentials(const std::vector<std::size_t>& well_indices,
                                                   const WellState<Scalar, IndexTraits>& well_state_copy,
                                                   std::string& exc_msg,
                                                   ExceptionType::ExcEnum& exc_type)
     {
         OPM_TIMEFUNCTION();
-        const int np = this->numPhases();
-        std::vector<Scalar> potentials;
+        if (this->useThreadedWells()) {
+            computePotentialsThreaded(well_indices, well_state_copy, exc_msg, exc_type);
+            return;
+        }
+        for (const auto widx : well_indices) {
+            std::vector<Scalar> potentials;
+            computeSingleWellPotentials(widx, well_state_copy, potentials, exc_msg, exc_type);
+            storeWellPotentials(widx, potentials);
+        }
+    }
+
+
+
+    template<typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::computePotentialsThreaded(const std::vector<std::size_t>& well_indices,
+                                                          const WellState<Scalar, IndexTraits>& well_state_copy,
+                                                          std::string& exc_msg,
+                                                          ExceptionType::ExcEnum& exc_type)
+    {
+        OPM_TIMEFUNCTION();
+        // The potentials of a well are computed on copies of the well and of
+        // the well state, so all wells that are not distributed can be handled
+        // concurrently, whether they share cells or not. Every well copies the
+        // whole well state, hence the potentials are only stored once all wells
+        // are done. Loggers and error messages are collected in well order.
+        const int num_wells = well_indices.size();
+        std::vector<std::vector<Scalar>> potentials(num_wells);
+        std::vector<DeferredLogger> well_loggers(num_wells);
+        std::vector<std::string> well_exc_msgs(num_wells);
+        std::vector<ExceptionType::ExcEnum> well_exc_types(num_wells, ExceptionType::NONE);
+
+        const auto isDistributed = [this, &well_indices](const int i)
+        {
+            return well_container_[well_indices[i]]->parallelWellInfo().communication().size() > 1;
+        };
+        const auto computeWell = [&](const int i)
+        {
+            auto logger_guard = this->groupStateHelper().redirectLogger(well_loggers[i]);
+            computeSingleWellPotentials(well_indices[i], well_state_copy, potentials[i],
+                                        well_exc_msgs[i], well_exc_types[i]);
+        };
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for (int i = 0; i < num_wells; ++i) {
+            if (!isDistributed(i)) {
+                computeWell(i);
+            }
+        }
+
+        // Distributed wells communicate when computing their potentials.
+        for (int i = 0; i < num_wells; ++i) {
+            if (isDistributed(i)) {
+                computeWell(i);
+            }
+        }
+
+        auto& deferred_logger = this->groupStateHelper().deferredLogger();
+        for (int i = 0; i < num_wells; ++i) {
+            deferred_logger.append(well_loggers[i]);
+            exc_msg += well_exc_msgs[i];
+            exc_type = std::max(exc_type, well_exc_types[i]);
+            storeWellPotentials(well_indices[i], potentials[i]);
+        }
+    }
+
+
+
+    template<typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::computeSingleWellPotentials(const std::size_t widx,
+                                                            const WellState<Scalar, IndexTraits>& well_state_copy,
+                                                            std::vector<Scalar>& potentials,
+                                                            std::string& exc_msg,
+                                                            ExceptionType::ExcEnum& exc_type)
+    {
+        OPM_TIMEFUNCTION();
         const auto& well = well_container_[widx];
         std::string cur_exc_msg;
         auto cur_exc_type = ExceptionType::NONE;
@@ -1946,10 +2171,20 @@ namespace Opm {
             exc_msg += fmt::format("\nFor well {}: {}", well->name(), cur_exc_msg);
         }
         exc_type = std::max(exc_type, cur_exc_type);
+    }
+
+
+
+    template<typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::storeWellPotentials(const std::size_t widx,
+                                                    const std::vector<Scalar>& potentials)
+    {
+        const int np = this->numPhases();
         // Store it in the well state
         // potentials is resized and set to zero in the beginning of well->ComputeWellPotentials
         // and updated only if sucessfull. i.e. the potentials are zero for exceptions
-        auto& ws = this->wellState().well(well->indexOfWell());
+        auto& ws = this->wellState().well(well_container_[widx]->indexOfWell());
         for (int p = 0; p < np; ++p) {
             // make sure the potentials are positive
             ws.well_potentials[p] = std::max(Scalar{0.0}, potentials[p]);
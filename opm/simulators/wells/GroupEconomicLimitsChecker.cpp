@@ -79,11 +79,11 @@ GroupEconomicLimitsChecker(const BlackoilWellModelGeneric<Scalar, IndexTraits>&
         auto phase_idx = this->phase_idx_map_[i];
         this->phase_idx_reverse_map_[phase_idx] = static_cast<int>(i);
         auto phase_pos = this->well_model_.phaseUsage().canonicalToActivePhaseIdx(phase_idx);
-        Scalar production_rate = this->well_model_.groupStateHelper().sumWellSurfaceRates(
+        this->production_rates_[i] = this->well_model_.groupStateHelper().sumWellSurfaceRates(
             this->group_, phase_pos, /*isInjector*/false
         );
-        this->production_rates_[i] = this->well_model_.comm().sum(production_rate);
     }
+    this->well_model_.comm().sum(this->production_rates_.data(), this->production_rates_.size());
 }
 
 /****************************************
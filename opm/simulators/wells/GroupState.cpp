@@ -28,6 +28,8 @@
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/simulators/wells/GroupState.hpp>
 
+#include <opm/simulators/utils/ReusingAssign.hpp>
+
 
 namespace Opm {
 
@@ -60,6 +62,66 @@ GroupState<Scalar> GroupState<Scalar>::serializationTestObject()
     return result;
 }
 
+template<class Scalar>
+GroupState<Scalar>& GroupState<Scalar>::operator=(const GroupState& other)
+{
+    // The same data members in the same order. A member which is added to
+    // GroupState without being listed here, and assigned below, changes
+    // the size of the class and fails this check.
+    struct Members
+    {
+        decltype(GroupState::num_phases) num_phases;
+        decltype(GroupState::m_production_rates) m_production_rates;
+        decltype(GroupState::m_network_leaf_node_production_rates) m_network_leaf_node_production_rates;
+        decltype(GroupState::production_controls) production_controls;
+        decltype(GroupState::m_prev_production_rates) m_prev_production_rates;
+        decltype(GroupState::prod_red_rates) prod_red_rates;
+        decltype(GroupState::inj_red_rates) inj_red_rates;
+        decltype(GroupState::inj_surface_rates) inj_surface_rates;
+        decltype(GroupState::inj_resv_rates) inj_resv_rates;
+        decltype(GroupState::inj_rein_rates) inj_rein_rates;
+        decltype(GroupState::inj_vrep_rate) inj_vrep_rate;
+        decltype(GroupState::m_grat_sales_target) m_grat_sales_target;
+        decltype(GroupState::m_gpmaint_target) m_gpmaint_target;
+        decltype(GroupState::group_thp) group_thp;
+        decltype(GroupState::production_group_potentials) production_group_potentials;
+        decltype(GroupState::m_number_of_wells_under_group_control) m_number_of_wells_under_group_control;
+        decltype(GroupState::m_number_of_wells_under_inj_group_control) m_number_of_wells_under_inj_group_control;
+        decltype(GroupState::injection_controls) injection_controls;
+        decltype(GroupState::gpmaint_state) gpmaint_state;
+        decltype(GroupState::m_gconsump_rates) m_gconsump_rates;
+    };
+    static_assert(sizeof(GroupState) == sizeof(Members),
+                  "Update GroupState::operator=() for the new data members");
+
+    if (this == &other) {
+        return *this;
+    }
+
+    this->num_phases = other.num_phases;
+    reusingAssign(this->m_production_rates, other.m_production_rates);
+    reusingAssign(this->m_network_leaf_node_production_rates, other.m_network_leaf_node_production_rates);
+    reusingAssign(this->production_controls, other.production_controls);
+    reusingAssign(this->m_prev_production_rates, other.m_prev_production_rates);
+    reusingAssign(this->prod_red_rates, other.prod_red_rates);
+    reusingAssign(this->inj_red_rates, other.inj_red_rates);
+    reusingAssign(this->inj_surface_rates, other.inj_surface_rates);
+    reusingAssign(this->inj_resv_rates, other.inj_resv_rates);
+    reusingAssign(this->inj_rein_rates, other.inj_rein_rates);
+    reusingAssign(this->inj_vrep_rate, other.inj_vrep_rate);
+    reusingAssign(this->m_grat_sales_target, other.m_grat_sales_target);
+    reusingAssign(this->m_gpmaint_target, other.m_gpmaint_target);
+    reusingAssign(this->group_thp, other.group_thp);
+    reusingAssign(this->production_group_potentials, other.production_group_potentials);
+    reusingAssign(this->m_number_of_wells_under_group_control, other.m_number_of_wells_under_group_control);
+    reusingAssign(this->m_number_of_wells_under_inj_group_control, other.m_number_of_wells_under_inj_group_control);
+    reusingAssign(this->injection_controls, other.injection_controls);
+    this->gpmaint_state = other.gpmaint_state;
+    reusingAssign(this->m_gconsump_rates, other.m_gconsump_rates);
+
+    return *this;
+}
+
 template<class Scalar>
 bool GroupState<Scalar>::operator==(const GroupState& other) const
 {
@@ -42,6 +42,13 @@ class GroupState {
 public:
     GroupState() = default;
     explicit GroupState(std::size_t num_phases);
+    GroupState(const GroupState&) = default;
+    GroupState(GroupState&&) = default;
+    GroupState& operator=(GroupState&&) = default;
+
+    /// Copy assignment which reuses the storage of the rates of groups
+    /// present in both states, as when committing or resetting a state.
+    GroupState& operator=(const GroupState& other);
 
     static GroupState serializationTestObject();
 
@@ -234,6 +241,9 @@ public:
     }
 
 private:
+    // Note to maintainers: If you add data members, then please update
+    // operator=(const GroupState&) as well. It checks at compile time that the
+    // list of members there is complete.
     std::size_t num_phases{};
     std::map<std::string, std::vector<Scalar>> m_production_rates;
     std::map<std::string, std::vector<Scalar>> m_network_leaf_node_production_rates;
@@ -27,6 +27,7 @@
 #include <opm/input/eclipse/Schedule/Network/ExtNetwork.hpp>
 #include <opm/material/fluidsystems/BlackOilDefaultFluidSystemIndices.hpp>
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
+#include <opm/simulators/utils/DeferredReduction.hpp>
 #include <opm/input/eclipse/Schedule/ResCoup/ReservoirCouplingInfo.hpp>
 #include <opm/simulators/wells/FractionCalculator.hpp>
 #include <opm/simulators/wells/TargetCalculator.hpp>
@@ -396,18 +397,42 @@ checkGroupProductionConstraints(const Group& group) const
     // and RC slave groups have only one mode imposed by the master.
     // The actual target enforcement happens in getProductionGroupTarget()
     // getProductionGroupTarget() via hasMasterProductionTarget().
-    for (const auto cmode : {
+    constexpr std::array cmodes = {
         Group::ProductionCMode::ORAT,
         Group::ProductionCMode::WRAT,
         Group::ProductionCMode::GRAT,
         Group::ProductionCMode::LRAT,
-        Group::ProductionCMode::RESV})
+        Group::ProductionCMode::RESV};
+    const auto isChecked = [&group, currentControl](const Group::ProductionCMode cmode)
     {
-        if (!group.has_control(cmode) || currentControl == cmode) {
+        return group.has_control(cmode) && currentControl != cmode;
+    };
+
+    // Sum the rates of all control modes to check over all nodes at once.
+    using Reduction = DeferredReduction<Scalar>;
+    Reduction rates(this->comm());
+    std::array<typename Reduction::Handle, cmodes.size()> currentRates;
+    typename Reduction::Handle waterRate;
+    for (std::size_t i = 0; i < cmodes.size(); ++i) {
+        if (isChecked(cmodes[i])) {
+            currentRates[i] = rates.sum(this->sumProductionRateForControlMode_(group, cmodes[i]));
+        }
+    }
+    if (isChecked(Group::ProductionCMode::LRAT)) {
+        const auto& pu = this->phaseUsage();
+        waterRate = rates.sum(this->sumWellSurfaceRates(group,
+            pu.canonicalToActivePhaseIdx(IndexTraits::waterPhaseIdx),
+            /*injector=*/false));
+    }
+    rates.reduce();
+
+    for (std::size_t i = 0; i < cmodes.size(); ++i) {
+        const auto cmode = cmodes[i];
+        if (!isChecked(cmode)) {
             continue;
         }
 
-        Scalar current_rate = this->sumProductionRateForControlMode_(group, cmode);
+        Scalar current_rate = rates[currentRates[i]];
         Scalar target = this->getProductionConstraintTarget_(group, cmode, controls);
 
         // LRAT skip heuristic: if liquid and oil targets are equal
@@ -415,12 +440,7 @@ checkGroupProductionConstraints(const Group& group) const
         if (cmode == Group::ProductionCMode::LRAT
             && target == controls.oil_target)
         {
-            const auto& pu = this->phaseUsage();
-            Scalar water_rate = this->sumWellSurfaceRates(group,
-                pu.canonicalToActivePhaseIdx(IndexTraits::waterPhaseIdx),
-                /*injector=*/false);
-            water_rate = this->comm().sum(water_rate);
-            if (std::abs(water_rate) < 1e-12) {
+            if (std::abs(rates[waterRate]) < 1e-12) {
                 this->deferredLogger().debug(
                     "LRAT_ORAT_GROUP",
                     "GROUP " + group.name()
@@ -672,21 +692,22 @@ std::vector<Scalar>
 GroupStateHelper<Scalar, IndexTraits>::
 getGroupRatesAvailableForHigherLevelControl(const Group& group, const bool is_injector) const
 {
+    // Sum the rates of all phases over all nodes at once.
     std::vector<Scalar> rates(this->numPhases(), 0.0);
-    if (is_injector) {
-        const std::vector<Scalar> reduction_rates = this->groupState().injection_reduction_rates(group.name());
-        for (int phasePos = 0; phasePos < this->numPhases(); ++phasePos) {
-            const Scalar local_current_rate = this->sumWellPhaseRates(
-                /*res_rates=*/false, group, phasePos, /*is_injector=*/true);
-            rates[phasePos] = this->comm_.sum(local_current_rate) - reduction_rates[phasePos];
-        }
+    for (int phasePos = 0; phasePos < this->numPhases(); ++phasePos) {
+        rates[phasePos] = this->sumWellPhaseRates(/*res_rates=*/false, group, phasePos, is_injector);
     }
-    else {
-        const std::vector<Scalar> reduction_rates = this->groupState().production_reduction_rates(group.name());
-        for (int phasePos = 0; phasePos < this->numPhases(); ++phasePos) {
-            const Scalar local_current_rate = this->sumWellPhaseRates(
-                /*res_rates=*/false, group, phasePos, /*is_injector=*/false);
-            rates[phasePos] = -this->comm_.sum(local_current_rate) - reduction_rates[phasePos];
+    this->comm_.sum(rates.data(), rates.size());
+
+    const std::vector<Scalar> reduction_rates = is_injector
+        ? this->groupState().injection_reduction_rates(group.name())
+        : this->groupState().production_reduction_rates(group.name());
+    for (int phasePos = 0; phasePos < this->numPhases(); ++phasePos) {
+        if (is_injector) {
+            rates[phasePos] -= reduction_rates[phasePos];
+        }
+        else {
+            rates[phasePos] = -rates[phasePos] - reduction_rates[phasePos];
         }
     }
     return rates;
@@ -1597,13 +1618,43 @@ std::pair<std::optional<std::string>, Scalar>
 GroupStateHelper<Scalar, IndexTraits>::worstOffendingWell(const Group& group,
                                                           const Group::ProductionCMode& offended_control) const
 {
+    // Sum the violating and preferred phase rates of all wells in the group tree
+    // over all nodes at once.
+    std::vector<std::string> wells;
+    std::vector<Scalar> rates;
+    this->collectOffendingWellRates_(group, offended_control, wells, rates);
+    if (!rates.empty()) {
+        this->comm_.sum(rates.data(), rates.size());
+    }
+
     std::pair<std::optional<std::string>, Scalar> offending_well {std::nullopt, 0.0};
+    for (std::size_t i = 0; i < wells.size(); ++i) {
+        const Scalar violating_rate = rates[2 * i];
+        const Scalar prefered_rate = rates[2 * i + 1];
+        if (violating_rate < 0) { // only check producing wells
+            Scalar fraction = prefered_rate < -1e-16 ? violating_rate / prefered_rate : 1.0;
+            if (fraction > offending_well.second) {
+                offending_well = {wells[i], fraction};
+            }
+        }
+    }
+    return offending_well;
+}
+
+// Called from worstOffendingWell().
+// - Appends the wells of the group tree, subgroups first, and the local rates of
+//   the violated and the preferred phase of each well.
+template <typename Scalar, typename IndexTraits>
+void
+GroupStateHelper<Scalar, IndexTraits>::
+collectOffendingWellRates_(const Group& group,
+                           const Group::ProductionCMode offended_control,
+                           std::vector<std::string>& wells,
+                           std::vector<Scalar>& rates) const
+{
     for (const std::string& child_group : group.groups()) {
         const auto& this_group = this->schedule_.getGroup(child_group, this->report_step_);
-        const auto& offending_well_this = this->worstOffendingWell(this_group, offended_control);
-        if (offending_well_this.second > offending_well.second) {
-            offending_well = offending_well_this;
-        }
+        this->collectOffendingWellRates_(this_group, offended_control, wells, rates);
     }
 
     for (const std::string& child_well : group.wells()) {
@@ -1684,16 +1735,10 @@ GroupStateHelper<Scalar, IndexTraits>::worstOffendingWell(const Group& group,
                 break;
             }
         }
-        violating_rate = this->comm_.sum(violating_rate);
-        if (violating_rate < 0) { // only check producing wells
-            prefered_rate = this->comm_.sum(prefered_rate);
-            Scalar fraction = prefered_rate < -1e-16 ? violating_rate / prefered_rate : 1.0;
-            if (fraction > offending_well.second) {
-                offending_well = {child_well, fraction};
-            }
-        }
+        wells.push_back(child_well);
+        rates.push_back(violating_rate);
+        rates.push_back(prefered_rate);
     }
-    return offending_well;
 }
 
 // ============================================================================
@@ -2122,7 +2167,8 @@ subtractOtherPhaseResvInjection_(
 }
 
 // Called from checkGroupProductionConstraints().
-// - Sums the well surface or reservoir rates for the group for the given production control mode.
+// - Sums the well surface or reservoir rates of the local wells of the group for the given
+//   production control mode. The caller sums the result over all processes.
 // - This is used to check if a group's constraint is broken by the current group's production rates.
 template<typename Scalar, typename IndexTraits>
 Scalar
@@ -2162,7 +2208,7 @@ sumProductionRateForControlMode_(const Group& group,
     default:
         break;
     }
-    return this->comm().sum(rate);
+    return rate;
 }
 
 // ============================================================================
@@ -47,6 +47,7 @@
 #include <stdexcept>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace Opm
@@ -113,6 +114,38 @@ public:
         GroupState<Scalar>* previous_state_ptr_ {nullptr};
     };
 
+    /// @brief RAII guard for temporarily redirecting the deferred logger
+    ///
+    /// @details Unlike ScopedLoggerGuard, the logger is owned by the caller and
+    /// nothing is gathered or logged on destruction. The redirection only applies
+    /// to the calling thread, and to the helper's current logger: the helper and
+    /// any copy of it made on this thread log to the given logger, while other
+    /// threads keep logging to the original one. The helper itself is not
+    /// modified, so several threads can share it, each with its own logger.
+    class LoggerRedirectGuard
+    {
+    public:
+        LoggerRedirectGuard(const GroupStateHelper& helper, DeferredLogger& logger)
+            : previous_ {thread_logger_redirect_}
+        {
+            thread_logger_redirect_ = {helper.deferred_logger_, &logger};
+        }
+
+        ~LoggerRedirectGuard()
+        {
+            thread_logger_redirect_ = previous_;
+        }
+
+        // Delete copy and move operations
+        LoggerRedirectGuard(const LoggerRedirectGuard&) = delete;
+        LoggerRedirectGuard& operator=(const LoggerRedirectGuard&) = delete;
+        LoggerRedirectGuard(LoggerRedirectGuard&&) = delete;
+        LoggerRedirectGuard& operator=(LoggerRedirectGuard&&) = delete;
+
+    private:
+        std::pair<DeferredLogger*, DeferredLogger*> previous_ {};
+    };
+
     /// @brief RAII guard that owns a DeferredLogger and auto-gathers on destruction
     ///
     /// @details This class provides a complete lifecycle for deferred logging in parallel
@@ -232,10 +265,14 @@ public:
     /// @throws std::logic_error if no logger has been set via pushLogger()
     DeferredLogger& deferredLogger() const
     {
-        if (this->deferred_logger_ == nullptr) {
+        DeferredLogger* logger = this->deferred_logger_;
+        if (thread_logger_redirect_.second != nullptr && logger == thread_logger_redirect_.first) {
+            logger = thread_logger_redirect_.second;
+        }
+        if (logger == nullptr) {
             throw std::logic_error("DeferredLogger not set. Call pushLogger() first.");
         }
-        return *this->deferred_logger_;
+        return *logger;
     }
 
     std::vector<Scalar> getGroupRatesAvailableForHigherLevelControl(const Group& group, const bool is_injector) const;
@@ -354,6 +391,14 @@ public:
         return ScopedLoggerGuard(*this, do_mpi_gather);
     }
 
+    /// @brief Redirect the deferred logger to a logger owned by the caller
+    /// @param logger Logger receiving the messages of the calling thread while the guard is alive
+    /// @return RAII guard restoring the previous logger
+    LoggerRedirectGuard redirectLogger(DeferredLogger& logger) const
+    {
+        return LoggerRedirectGuard(*this, logger);
+    }
+
     WellStateGuard pushWellState(WellState<Scalar, IndexTraits>& well_state)
     {
         return WellStateGuard(*this, well_state);
@@ -647,6 +692,11 @@ private:
 
     Scalar sumProductionRateForControlMode_(const Group& group, Group::ProductionCMode cmode) const;
 
+    void collectOffendingWellRates_(const Group& group,
+                                    const Group::ProductionCMode offended_control,
+                                    std::vector<std::string>& wells,
+                                    std::vector<Scalar>& rates) const;
+
     int updateGroupControlledWellsRecursive_(const std::string& group_name,
                                              const bool is_production_group,
                                              const Phase injection_phase);
@@ -718,6 +768,8 @@ private:
     // NOTE: The deferred logger does not change the object "meaningful" state, so it should be ok to
     //   make it mutable and store a pointer to it here.
     mutable DeferredLogger* deferred_logger_ {nullptr};
+    // Logger replaced on the calling thread and its replacement, see LoggerRedirectGuard.
+    static inline thread_local std::pair<DeferredLogger*, DeferredLogger*> thread_logger_redirect_ {};
     // NOTE: The phase usage info seems to be read-only throughout the simulation, so it should be safe
     // to store a reference to it here.
     const PhaseUsageInfo<IndexTraits>& phase_usage_info_;
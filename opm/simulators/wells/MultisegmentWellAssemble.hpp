@@ -39,6 +39,10 @@ template<class FluidSystem, class Indices> class WellInterfaceIndices;
 template<typename Scalar, typename IndexTraits> class WellState;
 template<typename Scalar, typename IndexTraits> class GroupStateHelper;
 
+namespace detail {
+struct VFPInterpHint;
+}
+
 //! \brief Class handling assemble of the equation system for MultisegmentWell.
 template<class FluidSystem, class Indices>
 class MultisegmentWellAssemble
@@ -71,6 +75,7 @@ public:
                            const Scalar rho,
                            const PrimaryVariables& primary_variables,
                            Equations& eqns,
+                           detail::VFPInterpHint& vfp_hint,
                            const bool stopped_or_zero_target) const;
 
     //! \brief Assemble piece of the acceleration term
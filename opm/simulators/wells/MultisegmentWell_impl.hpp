@@ -2007,6 +2007,7 @@ namespace Opm
                                         this->getRefDensity(),
                                         this->primary_variables_,
                                         this->linSys_,
+                                        this->vfpInterpHint(),
                                         stopped_or_zero_target);
             } else {
                 const UnitSystem& unit_system = simulator.vanguard().eclState().getDeckUnitSystem();
@@ -90,6 +90,7 @@ assembleControlEq(const GroupStateHelperType& groupStateHelper,
                   const PrimaryVariables& primary_variables,
                   const Scalar rho,
                   StandardWellEquationsType& eqns1,
+                  detail::VFPInterpHint& vfp_hint,
                   const bool stopped_or_zero_target) const
 {
     auto& deferred_logger = groupStateHelper.deferredLogger();
@@ -128,12 +129,12 @@ assembleControlEq(const GroupStateHelperType& groupStateHelper,
                                                  // Setup function for evaluation of BHP from THP (used only if needed).
         std::function<EvalWell()> bhp_from_thp = [&]() {
             const auto rates = getRates();
-            return WellBhpThpCalculator(well_).calculateBhpFromThp(well_state,
-                                                                   rates,
-                                                                   well,
-                                                                   summary_state,
-                                                                   rho,
-                                                                   deferred_logger);
+            return WellBhpThpCalculator(well_, vfp_hint).calculateBhpFromThp(well_state,
+                                                                             rates,
+                                                                             well,
+                                                                             summary_state,
+                                                                             rho,
+                                                                             deferred_logger);
         };
 
         WellAssemble(well_).
@@ -148,12 +149,12 @@ assembleControlEq(const GroupStateHelperType& groupStateHelper,
         const auto rates = getRates();
                                             // Setup function for evaluation of BHP from THP (used only if needed).
         std::function<EvalWell()> bhp_from_thp = [&]() {
-            return WellBhpThpCalculator(well_).calculateBhpFromThp(well_state,
-                                                                   rates,
-                                                                   well,
-                                                                   summary_state,
-                                                                   rho,
-                                                                   deferred_logger);
+            return WellBhpThpCalculator(well_, vfp_hint).calculateBhpFromThp(well_state,
+                                                                             rates,
+                                                                             well,
+                                                                             summary_state,
+                                                                             rho,
+                                                                             deferred_logger);
         };
         WellAssemble(well_).
             assembleControlEqProd(groupStateHelper,
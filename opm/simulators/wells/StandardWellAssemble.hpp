@@ -38,6 +38,10 @@ template<class FluidSystem> class WellInterfaceFluidSystem;
 template<typename Scalar, typename IndexTraits> class WellState;
 template<typename Scalar, typename IndexTraits> class GroupStateHelper;
 
+namespace detail {
+struct VFPInterpHint;
+}
+
 //! \brief Class handling assemble of the equation system for StandardWell.
 template<class FluidSystem, class Indices>
 class StandardWellAssemble
@@ -62,6 +66,7 @@ public:
                            const PrimaryVariables& primary_variables,
                            const Scalar rho,
                            StandardWellEquationsType& eqns,
+                           detail::VFPInterpHint& vfp_hint,
                            const bool stopped_or_zero_target) const;
 
     //! \brief Assemble injectivity equation.
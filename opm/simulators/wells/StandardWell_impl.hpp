@@ -488,6 +488,7 @@ namespace Opm
                                   this->primary_variables_,
                                   this->getRefDensity(),
                                   this->linSys_,
+                                  this->vfpInterpHint(),
                                   stopped_or_zero_target);
         }
 
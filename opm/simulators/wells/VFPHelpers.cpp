@@ -29,8 +29,11 @@
 #include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
 #include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
+#include <iterator>
 #include <stdexcept>
 
 namespace {
@@ -68,6 +71,30 @@ Scalar findX(const Scalar x0,
     return x;
 }
 
+/**
+ * Sets the interpolation factor of data whose indices are already set
+ */
+template<class Scalar>
+void setInterpFactor(Opm::detail::InterpData<Scalar>& data,
+                     const Scalar value,
+                     const std::vector<double>& values)
+{
+    const Scalar start = values[data.ind_[0]];
+    const Scalar end   = values[data.ind_[1]];
+
+    //Find interpolation ratio
+    if (end > start) {
+        //FIXME: Possible source for floating point error here if value and floor are large,
+        //but very close to each other
+        data.inv_dist_ = 1.0 / (end-start);
+        data.factor_ = (value-start) * data.inv_dist_;
+    }
+    else {
+        data.inv_dist_ = 0.0;
+        data.factor_ = 0.0;
+    }
+}
+
 /**
  * Returns zero if input value is negative
  */
@@ -112,32 +139,42 @@ detail::InterpData<Scalar> VFPHelpers<Scalar>::findInterpData(const Scalar value
             retval.ind_[1] = nvalues-1;
         }
         else {
-            //Search internal intervals
-            for (int i=1; i<nvalues; ++i) {
-                if (values[i] >= value) {
-                    retval.ind_[0] = i-1;
-                    retval.ind_[1] = i;
-                    break;
-                }
-            }
+            //Search internal intervals for the first element greater than or equal to value
+            const auto it = std::lower_bound(values.begin() + 1, values.end(), value);
+            const int i = std::distance(values.begin(), it);
+            retval.ind_[0] = i-1;
+            retval.ind_[1] = i;
         }
 
-        const Scalar start = values[retval.ind_[0]];
-        const Scalar end   = values[retval.ind_[1]];
+        setInterpFactor(retval, value, values);
+    }
 
-        //Find interpolation ratio
-        if (end > start) {
-            //FIXME: Possible source for floating point error here if value and floor are large,
-            //but very close to each other
-            retval.inv_dist_ = 1.0 / (end-start);
-            retval.factor_ = (value-start) * retval.inv_dist_;
-        }
-        else {
-            retval.inv_dist_ = 0.0;
-            retval.factor_ = 0.0;
-        }
+    return retval;
+}
+
+template<class Scalar>
+detail::InterpData<Scalar> VFPHelpers<Scalar>::findInterpData(const Scalar value_in,
+                                                              const std::vector<double>& values,
+                                                              int& hint)
+{
+    const int nvalues = values.size();
+    const Scalar value = value_in < 0.? 0. : value_in;
+
+    // The interval [hint, hint+1] is the one found by the search above if
+    // value lies inside it. Values on or outside the table ends are searched.
+    if (hint >= 0 && hint < nvalues - 1 && value < values.back() &&
+        value <= values[hint+1] &&
+        (hint == 0 ? value >= values.front() : value > values[hint]))
+    {
+        detail::InterpData<Scalar> retval;
+        retval.ind_[0] = hint;
+        retval.ind_[1] = hint+1;
+        setInterpFactor(retval, value, values);
+        return retval;
     }
 
+    const auto retval = findInterpData(value_in, values);
+    hint = retval.ind_[0];
     return retval;
 }
 
@@ -316,6 +353,24 @@ bhp(const VFPProdTable& table,
     const Scalar explicit_wfr,
     const Scalar explicit_gfr,
     const bool   use_vfpexplicit)
+{
+    detail::VFPInterpHint hint;
+    return bhp(table, aqua, liquid, vapour, thp, alq,
+               explicit_wfr, explicit_gfr, use_vfpexplicit, hint);
+}
+
+template<class Scalar>
+detail::VFPEvaluation<Scalar> VFPHelpers<Scalar>::
+bhp(const VFPProdTable& table,
+    const Scalar aqua,
+    const Scalar liquid,
+    const Scalar vapour,
+    const Scalar thp,
+    const Scalar alq,
+    const Scalar explicit_wfr,
+    const Scalar explicit_gfr,
+    const bool   use_vfpexplicit,
+    detail::VFPInterpHint& hint)
 {
     //Find interpolation variables
     Scalar flo = detail::getFlo(table, aqua, liquid, vapour);
@@ -328,11 +383,11 @@ bhp(const VFPProdTable& table,
 
     //First, find the values to interpolate between
     //Recall that flo is negative in Opm, so switch sign.
-    auto flo_i = findInterpData(-flo, table.getFloAxis());
-    auto thp_i = findInterpData( thp, table.getTHPAxis());
-    auto wfr_i = findInterpData( wfr, table.getWFRAxis());
-    auto gfr_i = findInterpData( gfr, table.getGFRAxis());
-    auto alq_i = findInterpData( alq, table.getALQAxis());
+    auto flo_i = findInterpData(-flo, table.getFloAxis(), hint.flo_);
+    auto thp_i = findInterpData( thp, table.getTHPAxis(), hint.thp_);
+    auto wfr_i = findInterpData( wfr, table.getWFRAxis(), hint.wfr_);
+    auto gfr_i = findInterpData( gfr, table.getGFRAxis(), hint.gfr_);
+    auto alq_i = findInterpData( alq, table.getALQAxis(), hint.alq_);
 
     detail::VFPEvaluation retval = interpolate(table, flo_i, thp_i, wfr_i, gfr_i, alq_i);
 
@@ -360,6 +415,103 @@ bhp(const VFPInjTable& table,
     return retval;
 }
 
+template<class Scalar>
+std::vector<Scalar> VFPHelpers<Scalar>::
+bhpAlongFloAxis(const VFPProdTable& table,
+                const detail::InterpData<Scalar>& thp_i,
+                const detail::InterpData<Scalar>& wfr_i,
+                const detail::InterpData<Scalar>& gfr_i,
+                const detail::InterpData<Scalar>& alq_i)
+{
+    const int nflo = table.getFloAxis().size();
+    std::vector<Scalar> bhps(nflo);
+
+    //Remove the dimensions one by one in the same order as interpolate(),
+    //so the values at the flo axis points match those of interpolate()
+    for (int f = 0; f < nflo; ++f) {
+        Scalar nn[2][2][2][2];
+        for (int t=0; t<=1; ++t) {
+            for (int w=0; w<=1; ++w) {
+                for (int g=0; g<=1; ++g) {
+                    for (int a=0; a<=1; ++a) {
+                        nn[t][w][g][a] = table(thp_i.ind_[t], wfr_i.ind_[w], gfr_i.ind_[g],
+                                               alq_i.ind_[a], f);
+                    }
+                }
+            }
+        }
+
+        Scalar t2 = alq_i.factor_;
+        Scalar t1 = (1.0-t2);
+        for (int t=0; t<=1; ++t) {
+            for (int w=0; w<=1; ++w) {
+                for (int g=0; g<=1; ++g) {
+                    nn[t][w][g][0] = t1*nn[t][w][g][0] + t2*nn[t][w][g][1];
+                }
+            }
+        }
+
+        t2 = gfr_i.factor_;
+        t1 = (1.0-t2);
+        for (int t=0; t<=1; ++t) {
+            for (int w=0; w<=1; ++w) {
+                nn[t][w][0][0] = t1*nn[t][w][0][0] + t2*nn[t][w][1][0];
+            }
+        }
+
+        t2 = wfr_i.factor_;
+        t1 = (1.0-t2);
+        for (int t=0; t<=1; ++t) {
+            nn[t][0][0][0] = t1*nn[t][0][0][0] + t2*nn[t][1][0][0];
+        }
+
+        t2 = thp_i.factor_;
+        t1 = (1.0-t2);
+        bhps[f] = t1*nn[0][0][0][0] + t2*nn[1][0][0][0];
+    }
+
+    return bhps;
+}
+
+template<class Scalar>
+std::vector<Scalar> VFPHelpers<Scalar>::
+bhps(const VFPProdTable& table,
+     const std::vector<Scalar>& flos,
+     const Scalar thp,
+     const Scalar wfr,
+     const Scalar gfr,
+     const Scalar alq)
+{
+    const auto thp_i = findInterpData(thp, table.getTHPAxis());
+    const auto wfr_i = findInterpData(wfr, table.getWFRAxis());
+    const auto gfr_i = findInterpData(gfr, table.getGFRAxis());
+    const auto alq_i = findInterpData(alq, table.getALQAxis());
+    const std::vector<Scalar> flo_bhps = bhpAlongFloAxis(table, thp_i, wfr_i, gfr_i, alq_i);
+
+    //Find the intervals first. The flo values are typically sorted, so the
+    //interval of the previous value is a good guess.
+    const std::size_t n = flos.size();
+    std::vector<int> lower(n);
+    std::vector<int> upper(n);
+    std::vector<Scalar> factor(n);
+    int hint = -1;
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto flo_i = findInterpData(flos[i], table.getFloAxis(), hint);
+        lower[i] = flo_i.ind_[0];
+        upper[i] = flo_i.ind_[1];
+        factor[i] = flo_i.factor_;
+    }
+
+    //Then interpolate along the flo axis, in a loop without branches
+    //which the compiler can vectorize.
+    std::vector<Scalar> bhps(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        bhps[i] = (1.0 - factor[i]) * flo_bhps[lower[i]] + factor[i] * flo_bhps[upper[i]];
+    }
+
+    return bhps;
+}
+
 template<class Scalar>
 Scalar VFPHelpers<Scalar>::
 findTHP(const std::vector<Scalar>& bhp_array,
@@ -534,11 +686,10 @@ getMinimumBHPCoordinate(const VFPProdTable& table,
     detail::VFPEvaluation bhp_i = interpolate(table, flo_i, thp_i, wfr_i, gfr_i, alq_i);
     Scalar bhp_min = bhp_i.value;
     const std::vector<double>& flos = table.getFloAxis();
+    const std::vector<Scalar> flo_bhps = bhpAlongFloAxis(table, thp_i, wfr_i, gfr_i, alq_i);
     for (size_t i = 0; i < flos.size(); ++i) {
-        flo_i = findInterpData(flos[i], flos);
-        bhp_i = interpolate(table, flo_i, thp_i, wfr_i, gfr_i, alq_i);
-        if (bhp_i.value < bhp_min){
-            bhp_min = bhp_i.value;
+        if (flo_bhps[i] < bhp_min){
+            bhp_min = flo_bhps[i];
             flo_at_bhp_min = flos[i];
         }
     }
@@ -589,11 +740,10 @@ intersectWithIPR(const VFPProdTable& table,
     y0 = adjust_bhp(bhp_i.value) - ipr_a/ipr_b; // +0.0/ipr_b
 
     const std::vector<double>& flos = table.getFloAxis();
+    const std::vector<Scalar> flo_bhps = bhpAlongFloAxis(table, thp_i, wfr_i, gfr_i, alq_i);
     for (size_t i = 0; i < flos.size(); ++i) {
         const auto flo1 = flos[i];
-        flo_i = findInterpData(flo1, flos);
-        bhp_i = interpolate(table, flo_i, thp_i, wfr_i, gfr_i, alq_i);
-        y1 = adjust_bhp(bhp_i.value) + (flo1 - ipr_a)/ipr_b;
+        y1 = adjust_bhp(flo_bhps[i]) + (flo1 - ipr_a)/ipr_b;
         if (y0 < 0 && y1 >= 0){
             // crossing with positive slope
             Scalar w = -y0/(y1-y0);
@@ -70,6 +70,22 @@ struct InterpData
     Scalar factor_; // Interpolation factor
 };
 
+/**
+ * Lower indices of the intervals found by the previous lookup of a well,
+ * one for each axis of a production table. The operating point of a well
+ * rarely leaves its interval between Newton iterations, so the next lookup
+ * first checks these intervals before searching the axes.
+ * A negative index means that no interval is known.
+ */
+struct VFPInterpHint
+{
+    int flo_ = -1;
+    int thp_ = -1;
+    int wfr_ = -1;
+    int gfr_ = -1;
+    int alq_ = -1;
+};
+
 /**
  * Computes the flo parameter according to the flo_type_
  * for production tables
@@ -147,6 +163,14 @@ public:
     static detail::InterpData<Scalar> findInterpData(const Scalar value_in,
                                                      const std::vector<double>& values);
 
+    /**
+     * As above, but first checks the interval starting at index hint, which
+     * is updated to the lower index of the interval found.
+     */
+    static detail::InterpData<Scalar> findInterpData(const Scalar value_in,
+                                                     const std::vector<double>& values,
+                                                     int& hint);
+
     /**
      * Helper function which interpolates data using the indices etc. given in the inputs.
      */
@@ -175,12 +199,51 @@ public:
                                              const Scalar explicit_gfr,
                                              const bool   use_vfpexplicit);
 
+    /**
+     * As above, but starts the lookups in the intervals given by hint,
+     * which is updated with the intervals found.
+     */
+    static detail::VFPEvaluation<Scalar> bhp(const VFPProdTable& table,
+                                             const Scalar aqua,
+                                             const Scalar liquid,
+                                             const Scalar vapour,
+                                             const Scalar thp,
+                                             const Scalar alq,
+                                             const Scalar explicit_wfr,
+                                             const Scalar explicit_gfr,
+                                             const bool   use_vfpexplicit,
+                                             detail::VFPInterpHint& hint);
+
     static detail::VFPEvaluation<Scalar> bhp(const VFPInjTable& table,
                                              const Scalar aqua,
                                              const Scalar liquid,
                                              const Scalar vapour,
                                              const Scalar thp);
 
+    /**
+     * Reduces the table to the bhp values at the points of the flo axis, for
+     * fixed thp, wfr, gfr and alq. The bhp is then a piecewise linear function
+     * of flo, which is cheap to evaluate at many flo values.
+     */
+    static std::vector<Scalar> bhpAlongFloAxis(const VFPProdTable& table,
+                                               const detail::InterpData<Scalar>& thp_i,
+                                               const detail::InterpData<Scalar>& wfr_i,
+                                               const detail::InterpData<Scalar>& gfr_i,
+                                               const detail::InterpData<Scalar>& alq_i);
+
+    /**
+     * Batched interpolation of bhp for many flo values (positive, as in the
+     * table) sharing the same thp, wfr, gfr and alq. Gives the same values
+     * as interpolate() up to rounding, for a fraction of the cost when there
+     * are more than a few points.
+     */
+    static std::vector<Scalar> bhps(const VFPProdTable& table,
+                                    const std::vector<Scalar>& flos,
+                                    const Scalar thp,
+                                    const Scalar wfr,
+                                    const Scalar gfr,
+                                    const Scalar alq);
+
     /**
      * This function finds the value of THP given a specific BHP.
      * Essentially:
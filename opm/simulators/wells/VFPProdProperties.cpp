@@ -27,7 +27,8 @@
 
 #include <opm/simulators/wells/VFPHelpers.hpp>
 
-#include <cstddef>
+#include <algorithm>
+#include <vector>
 
 namespace Opm {
 
@@ -84,16 +85,38 @@ bhp(const int     table_id,
      const Scalar alq,
      const Scalar explicit_wfr,
      const Scalar explicit_gfr,
-     const bool   use_expvfp) const
+     const bool   use_expvfp,
+     detail::VFPInterpHint* hint) const
 {
     const VFPProdTable& table = detail::getTable(m_tables, table_id);
 
+    detail::VFPInterpHint no_hint;
     detail::VFPEvaluation retval = VFPHelpers<Scalar>::bhp(table, aqua, liquid, vapour,
                                                            thp_arg, alq, explicit_wfr,
-                                                           explicit_gfr, use_expvfp);
+                                                           explicit_gfr, use_expvfp,
+                                                           hint ? *hint : no_hint);
     return retval.value;
 }
 
+template<class Scalar>
+std::vector<Scalar>
+VFPProdProperties<Scalar>::
+bhps(const int table_id,
+     const std::vector<Scalar>& flos,
+     const Scalar thp,
+     const Scalar wfr,
+     const Scalar gfr,
+     const Scalar alq) const
+{
+    const VFPProdTable& table = detail::getTable(m_tables, table_id);
+
+    // Value of FLO is negative in OPM for producers, but positive in VFP table
+    std::vector<Scalar> table_flos(flos.size());
+    std::ranges::transform(flos, table_flos.begin(), [](const Scalar flo) { return -flo; });
+
+    return VFPHelpers<Scalar>::bhps(table, table_flos, thp, wfr, gfr, alq);
+}
+
 template<class Scalar>
 const VFPProdTable&
 VFPProdProperties<Scalar>::getTable(const int table_id) const
@@ -118,21 +141,11 @@ bhpwithflo(const std::vector<Scalar>& flos,
            const Scalar alq,
            const Scalar dp) const
 {
-    // Get the table
-    const VFPProdTable& table = detail::getTable(m_tables, table_id);
-    const auto thp_i = VFPHelpers<Scalar>::findInterpData( thp, table.getTHPAxis()); // assume constant
-    const auto wfr_i = VFPHelpers<Scalar>::findInterpData( wfr, table.getWFRAxis());
-    const auto gfr_i = VFPHelpers<Scalar>::findInterpData( gfr, table.getGFRAxis());
-    const auto alq_i = VFPHelpers<Scalar>::findInterpData( alq, table.getALQAxis()); //assume constant
-
-    std::vector<Scalar> bhps(flos.size(), 0.);
-    for (std::size_t i = 0; i < flos.size(); ++i) {
-        // Value of FLO is negative in OPM for producers, but positive in VFP table
-        const auto flo_i = VFPHelpers<Scalar>::findInterpData(-flos[i], table.getFloAxis());
-        const detail::VFPEvaluation bhp_val = VFPHelpers<Scalar>::interpolate(table, flo_i, thp_i, wfr_i, gfr_i, alq_i);
-
-        // TODO: this kind of breaks the conventions for the functions here by putting dp within the function
-        bhps[i] = bhp_val.value - dp;
+    std::vector<Scalar> bhps = this->bhps(table_id, flos, thp, wfr, gfr, alq);
+
+    // TODO: this kind of breaks the conventions for the functions here by putting dp within the function
+    for (auto& bhp : bhps) {
+        bhp -= dp;
     }
 
     return bhps;
@@ -170,7 +183,8 @@ bhp(const int       table_id,
     const Scalar    alq,
     const Scalar    explicit_wfr,
     const Scalar    explicit_gfr,
-    const bool      use_expvfp) const
+    const bool      use_expvfp,
+    detail::VFPInterpHint* hint) const
 {
     //Get the table
     const VFPProdTable& table = detail::getTable(m_tables, table_id);
@@ -187,11 +201,13 @@ bhp(const int       table_id,
 
     //First, find the values to interpolate between
     //Value of FLO is negative in OPM for producers, but positive in VFP table
-    auto flo_i = VFPHelpers<Scalar>::findInterpData(-flo.value(), table.getFloAxis());
-    auto thp_i = VFPHelpers<Scalar>::findInterpData( thp, table.getTHPAxis()); // assume constant
-    auto wfr_i = VFPHelpers<Scalar>::findInterpData( wfr.value(), table.getWFRAxis());
-    auto gfr_i = VFPHelpers<Scalar>::findInterpData( gfr.value(), table.getGFRAxis());
-    auto alq_i = VFPHelpers<Scalar>::findInterpData( alq, table.getALQAxis()); //assume constant
+    detail::VFPInterpHint no_hint;
+    auto& h = hint ? *hint : no_hint;
+    auto flo_i = VFPHelpers<Scalar>::findInterpData(-flo.value(), table.getFloAxis(), h.flo_);
+    auto thp_i = VFPHelpers<Scalar>::findInterpData( thp, table.getTHPAxis(), h.thp_); // assume constant
+    auto wfr_i = VFPHelpers<Scalar>::findInterpData( wfr.value(), table.getWFRAxis(), h.wfr_);
+    auto gfr_i = VFPHelpers<Scalar>::findInterpData( gfr.value(), table.getGFRAxis(), h.gfr_);
+    auto alq_i = VFPHelpers<Scalar>::findInterpData( alq, table.getALQAxis(), h.alq_); //assume constant
 
     detail::VFPEvaluation bhp_val = VFPHelpers<Scalar>::interpolate(table, flo_i, thp_i, wfr_i,
                                                                     gfr_i, alq_i);
@@ -211,7 +227,8 @@ bhp(const int       table_id,
                               const T ,           \
                               const T ,           \
                               const T ,           \
-                              const bool) const;
+                              const bool,         \
+                              detail::VFPInterpHint*) const;
 
 #define INSTANTIATE_TYPE(T)                        \
     template class VFPProdProperties<T>;           \
@@ -29,6 +29,10 @@ namespace Opm {
 
 class VFPProdTable;
 
+namespace detail {
+struct VFPInterpHint;
+}
+
 /**
  * Class which linearly interpolates BHP as a function of rate, tubing head pressure,
  * water fraction, gas fraction, and artificial lift for production VFP tables, and similarly
@@ -57,6 +61,8 @@ public:
      * @param explicit_wfr Explicit wfr
      * @param explicit_gfr Explicit gfr
      * @param use_expvfp True to use explicit VFP calculations
+     * @param hint If given, the intervals of the previous lookup of the well,
+     *             which are checked first and updated
      *
      * @return The bottom hole pressure, interpolated/extrapolated linearly using
      * the above parameters from the values in the input table, for each entry in the
@@ -71,7 +77,8 @@ public:
                  const Scalar    alq,
                  const Scalar    explicit_wfr,
                  const Scalar    explicit_gfr,
-                 const bool      use_expvfp) const;
+                 const bool      use_expvfp,
+                 detail::VFPInterpHint* hint = nullptr) const;
 
     /**
      * Linear interpolation of bhp as a function of the input parameters
@@ -84,6 +91,8 @@ public:
      * @param explicit_wfr Explicit wfr
      * @param explicit_gfr Explicit gfr
      * @param use_expvfp True to use explicit VFP calculations
+     * @param hint If given, the intervals of the previous lookup of the well,
+     *             which are checked first and updated
      *
      * @return The bottom hole pressure, interpolated/extrapolated linearly using
      * the above parameters from the values in the input table.
@@ -96,7 +105,27 @@ public:
                const Scalar alq,
                const Scalar explicit_wfr,
                const Scalar explicit_gfr,
-               const bool   use_expvfp) const;
+               const bool   use_expvfp,
+               detail::VFPInterpHint* hint = nullptr) const;
+
+    /**
+     * Linear interpolation of bhp for many rates sharing the same thp, wfr,
+     * gfr and alq, evaluated in one batch.
+     * @param table_id Table number to use
+     * @param flos Rates of the flo type of the table, negative for producers
+     * @param thp Tubing head pressure
+     * @param wfr Water fraction
+     * @param gfr Gas fraction
+     * @param alq Artificial lift or other parameter
+     *
+     * @return The bottom hole pressure for each of the rates.
+     */
+    std::vector<Scalar> bhps(const int table_id,
+                             const std::vector<Scalar>& flos,
+                             const Scalar thp,
+                             const Scalar wfr,
+                             const Scalar gfr,
+                             const Scalar alq) const;
 
     /**
      * Linear interpolation of thp as a function of the input parameters
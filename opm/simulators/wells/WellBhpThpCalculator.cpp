@@ -231,7 +231,9 @@ computeBhpAtThpLimitProd(const std::function<std::vector<Scalar>(const Scalar)>&
                                                                 rho,
                                                                 well_.gravity());
 
-    auto fbhp = [this, &controls, thp_limit, dp, alq_value](const std::vector<Scalar>& rates) {
+    detail::VFPInterpHint local_hint = well_.vfpInterpHint();
+    detail::VFPInterpHint* hint = vfp_hint_ ? vfp_hint_ : &local_hint;
+    auto fbhp = [this, &controls, thp_limit, dp, alq_value, hint](const std::vector<Scalar>& rates) {
         assert(rates.size() == 3);
         const auto& wfr =  well_.vfpProperties()->getExplicitWFR(controls.vfp_table_number,
                                                                 well_.indexOfWell());
@@ -246,7 +248,8 @@ computeBhpAtThpLimitProd(const std::function<std::vector<Scalar>(const Scalar)>&
                                                                  alq_value,
                                                                  wfr,
                                                                  gfr,
-                                                                 use_vfpexp);
+                                                                 use_vfpexp,
+                                                                 hint);
         return bhp - dp + getVfpBhpAdjustment(bhp, thp_limit);
     };
 
@@ -381,12 +384,14 @@ calculateBhpFromThp(const WellState<Scalar, IndexTraits>& well_state,
         const auto& wfr =  well_.vfpProperties()->getExplicitWFR(controls.vfp_table_number, well_.indexOfWell());
         const auto& gfr = well_.vfpProperties()->getExplicitGFR(controls.vfp_table_number, well_.indexOfWell());
         const bool use_vfpexplicit = well_.useVfpExplicit();
+        detail::VFPInterpHint local_hint = well_.vfpInterpHint();
 
         bhp_tab = well_.vfpProperties()->getProd()->bhp(controls.vfp_table_number,
                                                       aqua, liquid, vapour,
                                                       thp_limit,
                                                       well_.getALQ(well_state),
-                                                      wfr, gfr, use_vfpexplicit);
+                                                      wfr, gfr, use_vfpexplicit,
+                                                      vfp_hint_ ? vfp_hint_ : &local_hint);
     }
     else {
         OPM_DEFLOG_THROW(std::logic_error, "Expected INJECTOR or PRODUCER for well " + well_.name(), deferred_logger);
@@ -36,6 +36,10 @@ class Well;
 template<typename Scalar, typename IndexTraits> class WellInterfaceGeneric;
 template<typename Scalar, typename IndexTraits> class WellState;
 
+namespace detail {
+struct VFPInterpHint;
+}
+
 //! \brief Class for computing BHP limits.
 template<typename Scalar, typename IndexTraits>
 class WellBhpThpCalculator {
@@ -43,6 +47,12 @@ public:
     //! \brief Constructor sets reference to well.
     explicit WellBhpThpCalculator(const WellInterfaceGeneric<Scalar, IndexTraits>& well) : well_(well) {}
 
+    //! \brief Constructor sets reference to well and to the VFP interpolation
+    //!        hint of the well, which the production VFP lookups update.
+    WellBhpThpCalculator(const WellInterfaceGeneric<Scalar, IndexTraits>& well,
+                         detail::VFPInterpHint& vfp_hint)
+        : well_(well), vfp_hint_(&vfp_hint) {}
+
     //! \brief Checks if well has THP constraints.
     bool wellHasTHPConstraints(const SummaryState& summaryState) const;
 
@@ -187,6 +197,9 @@ private:
                                      DeferredLogger& deferred_logger) const;
 
     const WellInterfaceGeneric<Scalar, IndexTraits>& well_; //!< Reference to well interface
+    //! Hint updated by the production VFP lookups, if any. Otherwise the
+    //! lookups start from a copy of the hint of the well.
+    detail::VFPInterpHint* vfp_hint_ = nullptr;
 };
 
 }
@@ -0,0 +1,65 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+#include <opm/simulators/wells/WellColoring.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <unordered_map>
+
+namespace Opm {
+
+std::vector<std::vector<int>>
+groupWellsByDisjointCells(const std::vector<std::vector<int>>& well_cells)
+{
+    // Wells perforating each cell.
+    std::unordered_map<int, std::vector<int>> cell_wells;
+    for (std::size_t w = 0; w < well_cells.size(); ++w) {
+        for (const int cell : well_cells[w]) {
+            cell_wells[cell].push_back(w);
+        }
+    }
+
+    std::vector<int> well_color(well_cells.size(), -1);
+    std::vector<std::vector<int>> groups;
+    std::vector<char> color_taken;
+    for (std::size_t w = 0; w < well_cells.size(); ++w) {
+        // Colors of the already colored wells sharing a cell with this one.
+        color_taken.assign(groups.size(), false);
+        for (const int cell : well_cells[w]) {
+            for (const int other : cell_wells[cell]) {
+                if (well_color[other] >= 0) {
+                    color_taken[well_color[other]] = true;
+                }
+            }
+        }
+        const auto color = std::distance(color_taken.begin(),
+                                         std::find(color_taken.begin(), color_taken.end(), false));
+        if (color == static_cast<std::ptrdiff_t>(groups.size())) {
+            groups.emplace_back();
+        }
+        well_color[w] = color;
+        groups[color].push_back(w);
+    }
+
+    return groups;
+}
+
+} // namespace Opm
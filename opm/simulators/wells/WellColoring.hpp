@@ -0,0 +1,42 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_WELL_COLORING_HEADER_INCLUDED
+#define OPM_WELL_COLORING_HEADER_INCLUDED
+
+#include <vector>
+
+namespace Opm {
+
+/// Partition wells into groups such that no two wells of a group
+/// perforate the same cell.
+///
+/// The wells of a group write to disjoint parts of the reservoir
+/// vectors and can hence be processed concurrently. The coloring is
+/// greedy and visits the wells in order, so the result only depends on
+/// the input and not on the number of threads used later.
+///
+/// \param[in] well_cells Perforated cells of each well.
+/// \return Groups of well indices, each sorted in increasing order.
+std::vector<std::vector<int>>
+groupWellsByDisjointCells(const std::vector<std::vector<int>>& well_cells);
+
+} // namespace Opm
+
+#endif // OPM_WELL_COLORING_HEADER_INCLUDED
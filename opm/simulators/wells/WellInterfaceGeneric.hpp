@@ -27,6 +27,7 @@
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
 #include <opm/simulators/flow/BlackoilModelParameters.hpp>
 #include <opm/simulators/wells/RuntimePerforation.hpp>
+#include <opm/simulators/wells/VFPHelpers.hpp>
 
 #include <map>
 #include <optional>
@@ -143,6 +144,10 @@ public:
 
     const VFPProperties<Scalar, IndexTraits>* vfpProperties() const { return vfp_properties_; }
 
+    //! \brief Intervals of the last production VFP table lookup of the well.
+    const detail::VFPInterpHint& vfpInterpHint() const { return vfp_interp_hint_; }
+    detail::VFPInterpHint& vfpInterpHint() { return vfp_interp_hint_; }
+
     const ParallelWellInfo<Scalar>& parallelWellInfo() const { return parallel_well_info_; }
 
     const std::vector<Scalar>& perfDepth() const { return perf_depth_; }
@@ -402,6 +407,7 @@ protected:
 
     Scalar well_efficiency_factor_;
     const VFPProperties<Scalar, IndexTraits>* vfp_properties_;
+    detail::VFPInterpHint vfp_interp_hint_;
     const GuideRate* guide_rate_;
 
     std::vector<std::string> well_control_log_;
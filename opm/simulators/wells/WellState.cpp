@@ -39,6 +39,7 @@
 #include <opm/simulators/wells/RunningStatistics.hpp>
 
 #include <opm/simulators/utils/ParallelCommunication.hpp>
+#include <opm/simulators/utils/ReusingAssign.hpp>
 
 #include <opm/grid/common/p2pcommunicator.hh>
 
@@ -1378,6 +1379,41 @@ updateWellsDefaultALQ(const Schedule& schedule,
     }
 }
 
+template<typename Scalar, typename IndexTraits>
+WellState<Scalar, IndexTraits>&
+WellState<Scalar, IndexTraits>::operator=(const WellState& other)
+{
+    // The same data members in the same order. A member which is added to
+    // WellState without being listed here, and assigned below, changes
+    // the size of the class and fails this check.
+    struct Members
+    {
+        decltype(WellState::enableDistributedWells_) enableDistributedWells_;
+        decltype(WellState::phaseUsageInfo_) phaseUsageInfo_;
+        decltype(WellState::wells_) wells_;
+        decltype(WellState::global_well_info) global_well_info;
+        decltype(WellState::well_rates) well_rates;
+        decltype(WellState::permanently_inactive_well_names_) permanently_inactive_well_names_;
+    };
+    static_assert(sizeof(WellState) == sizeof(Members),
+                  "Update WellState::operator=() for the new data members");
+
+    if (this == &other) {
+        return *this;
+    }
+
+    // The per-well containers are assigned element by element when the
+    // wells are the same, which keeps the storage of every field.
+    this->enableDistributedWells_ = other.enableDistributedWells_;
+    this->phaseUsageInfo_ = other.phaseUsageInfo_;
+    this->wells_ = other.wells_;
+    this->global_well_info = other.global_well_info;
+    reusingAssign(this->well_rates, other.well_rates);
+    this->permanently_inactive_well_names_ = other.permanently_inactive_well_names_;
+
+    return *this;
+}
+
 template<typename Scalar, typename IndexTraits>
 bool WellState<Scalar, IndexTraits>::operator==(const WellState& rhs) const
 {
@@ -99,6 +99,14 @@ public:
         : phaseUsageInfo_(pu)
     {}
 
+    WellState(const WellState&) = default;
+    WellState(WellState&&) = default;
+    WellState& operator=(WellState&&) = default;
+
+    /// Copy assignment which reuses the storage of this state where the
+    /// wells are the same, as when committing or resetting a state.
+    WellState& operator=(const WellState& other);
+
     static WellState serializationTestObject(const ParallelWellInfo<Scalar>& pinfo);
 
     std::size_t size() const
@@ -355,6 +363,9 @@ public:
     }
 
 private:
+    // Note to maintainers: If you add data members, then please update
+    // operator=(const WellState&) as well. It checks at compile time that the
+    // list of members there is complete.
     bool enableDistributedWells_ = false;
 
     PhaseUsageInfo<IndexTraits> phaseUsageInfo_;
@@ -53,9 +53,7 @@ void
 RescoupReceiveSlaveGroupData<Scalar, IndexTraits>::
 receiveSlaveGroupData()
 {
-    auto& rescoup_master = this->reservoir_coupling_master_;
-    rescoup_master.receiveProductionDataFromSlaves();
-    rescoup_master.receiveInjectionDataFromSlaves();
+    this->reservoir_coupling_master_.receiveDataFromSlaves();
 }
 
 
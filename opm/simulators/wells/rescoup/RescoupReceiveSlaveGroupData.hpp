@@ -67,9 +67,9 @@ public:
     /// it available for group control calculations.
     ///
     /// The method performs the following operations:
-    /// 1. Receives production data (rates and potentials) from all slaves
-    /// 2. Receives injection data (rates) from all slaves
-    /// 3. Processes and stores the data in appropriate group state structures
+    /// 1. Receives production data (rates and potentials) and injection data (rates)
+    ///    from all slaves, in the order the slaves send it
+    /// 2. Processes and stores the data in appropriate group state structures
     ///
     /// @note This is a blocking operation that waits for all slaves to send their data
     /// @note Must be called at appropriate synchronization points in the simulation
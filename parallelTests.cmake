@@ -423,3 +423,60 @@ add_test_compareSeparateECLFiles(CASENAME actionx_compdat_nldd_2_procs
                                  IGNORE_EXTRA_KW BOTH
                                  MPI_PROCS 2
                                  TEST_ARGS --nonlinear-solver=nldd --matrix-add-well-contributions=true --linear-solver=ilu0)
+
+add_test_compareSeparateECLFiles(CASENAME actionx_compdat_nldd_jacobi_threads
+                                 DIR1 actionx
+                                 FILENAME1 COMPDAT_SHORT
+                                 DIR2 actionx
+                                 FILENAME2 ACTIONX_COMPDAT_SHORT
+                                 SIMULATOR flow
+                                 ABS_TOL ${abs_tol}
+                                 REL_TOL ${rel_tol}
+                                 IGNORE_EXTRA_KW BOTH
+                                 MPI_PROCS 1
+                                 TEST_ARGS --nonlinear-solver=nldd --local-solve-approach=jacobi --nldd-num-threads=2 --threads-per-process=2 --matrix-add-well-contributions=true --linear-solver=ilu0)
+
+add_test_compareSeparateECLFiles(CASENAME actionx_compdat_nldd_gs_threads
+                                 DIR1 actionx
+                                 FILENAME1 COMPDAT_SHORT
+                                 DIR2 actionx
+                                 FILENAME2 ACTIONX_COMPDAT_SHORT
+                                 SIMULATOR flow
+                                 ABS_TOL ${abs_tol}
+                                 REL_TOL ${rel_tol}
+                                 IGNORE_EXTRA_KW BOTH
+                                 MPI_PROCS 1
+                                 TEST_ARGS --nonlinear-solver=nldd --local-solve-approach=gauss-seidel --nldd-num-threads=2 --threads-per-process=2 --matrix-add-well-contributions=true --linear-solver=ilu0)
+
+add_test_compareSeparateECLFiles(CASENAME actionx_compdat_threaded_wells
+                                 DIR1 actionx
+                                 FILENAME1 COMPDAT_SHORT
+                                 DIR2 actionx
+                                 FILENAME2 ACTIONX_COMPDAT_SHORT
+                                 SIMULATOR flow
+                                 ABS_TOL ${abs_tol}
+                                 REL_TOL ${rel_tol}
+                                 IGNORE_EXTRA_KW BOTH
+                                 MPI_PROCS 1
+                                 TEST_ARGS --threaded-wells=true --threads-per-process=2 --linear-solver=ilu0)
+
+# Scaling of the threaded NLDD subdomain solves on a Norne-sized case. Both
+# runs give the same results, compare their run times. They are run serially
+# so that the timings are not disturbed by other tests.
+opm_set_test_driver(${PROJECT_SOURCE_DIR}/tests/run-test.sh "")
+
+add_test_runSimulator(CASENAME norne_nldd_jacobi_1_thread
+                      FILENAME NORNE_ATW2013
+                      SIMULATOR flow
+                      DIR norne
+                      CONFIGURATION extra
+                      TEST_ARGS --nonlinear-solver=nldd --local-solve-approach=jacobi --nldd-num-threads=1 --threads-per-process=1 --matrix-add-well-contributions=true)
+set_tests_properties(runSimulator/norne_nldd_jacobi_1_thread PROPERTIES RUN_SERIAL TRUE)
+
+add_test_runSimulator(CASENAME norne_nldd_jacobi_4_threads
+                      FILENAME NORNE_ATW2013
+                      SIMULATOR flow
+                      DIR norne
+                      CONFIGURATION extra
+                      TEST_ARGS --nonlinear-solver=nldd --local-solve-approach=jacobi --nldd-num-threads=4 --threads-per-process=4 --matrix-add-well-contributions=true)
+set_tests_properties(runSimulator/norne_nldd_jacobi_4_threads PROPERTIES PROCESSORS 4 RUN_SERIAL TRUE)
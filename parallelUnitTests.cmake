@@ -34,6 +34,23 @@ opm_add_test(test_gatherdeferredlogger
     4
 )
 
+opm_add_test(test_pendingrequests
+  DEPENDS
+    opmsimulators
+  LIBRARIES
+    opmsimulators
+    Boost::unit_test_framework
+  SOURCES
+    tests/rescoup/test_pendingrequests.cpp
+  CONDITION
+    MPI_FOUND AND Boost_UNIT_TEST_FRAMEWORK_FOUND
+  DRIVER_ARGS
+    -n 4
+    -b ${PROJECT_BINARY_DIR}
+  PROCESSORS
+    4
+)
+
 opm_add_test(test_parallelwellinfo_mpi
   EXE_NAME
     test_parallelwellinfo
@@ -203,6 +220,23 @@ opm_add_test(test_HDF5Serializer_Parallel
     4
 )
 
+opm_add_test(test_mixedbsr_parallel
+  DEPENDS
+    opmsimulators
+  LIBRARIES
+    opmsimulators
+    Boost::unit_test_framework
+  SOURCES
+    tests/test_mixedbsr_parallel.cpp
+  CONDITION
+    HAVE_AVX2_EXTENSION AND MPI_FOUND AND Boost_UNIT_TEST_FRAMEWORK_FOUND
+  DRIVER_ARGS
+    -n 4
+    -b ${PROJECT_BINARY_DIR}
+  PROCESSORS
+    4
+)
+
 opm_add_test(test_rstconv_parallel
   EXE_NAME
     test_rstconv
@@ -6,7 +6,7 @@ import subprocess
 
 from utils import Dense, Sequential
 from utils import collect_input_features, compute_output_vars, write_config, extract_newtit_from_file, extract_unrst_variables
-from utils import ABSOLUTE_CASES, RELATIVE_CASES, FEATURE_ENGINEERING_CASES, SCALING_CASES, MULTI_MODEL_CASES, ZERO_NEWTON_CASES, ALL_CASES
+from utils import ABSOLUTE_CASES, RELATIVE_CASES, FEATURE_ENGINEERING_CASES, SCALING_CASES, MULTI_MODEL_CASES, ZERO_NEWTON_CASES, ALL_CASES, CACHED_MODEL_CASES
 
 from opm.ml.ml_tools.kerasify import export_model
 
@@ -93,7 +93,7 @@ class TestHybridNewton(unittest.TestCase):
                 Dense(input_dim=input_flat.shape[0], output_dim=output_flat.shape[0])
             ])
             model.layers[0].set_weights([np.zeros((input_flat.shape[0], output_flat.shape[0])), output_flat])
-            apply_time = self.times[start_idx]
+            apply_time = self.times[model_case.get("apply_idx", start_idx)]
 
             active_cells = list(range(self.n_cells))
 
@@ -166,6 +166,20 @@ class TestHybridNewton(unittest.TestCase):
         hybrid_iters = self._run_cases(ALL_CASES)
         print(f"Hybrid Newton iterations all_cases: {hybrid_iters}")
 
+    def test_cached_model_cases(self):
+        # The same model file is used by two configurations, so the second
+        # application reuses the loaded model. The states must still match
+        # the baseline, as they did when the model was loaded for each use.
+        hybrid_iters = self._run_cases(CACHED_MODEL_CASES)
+        self.assertEqual(len(hybrid_iters), len(self.baseline_iters))
+
+        unrst, times = extract_unrst_variables(".", self.deck_file)
+        self.assertEqual(len(times), len(self.times))
+        for var in ["PRESSURE", "SGAS", "SWAT", "RS"]:
+            for step, (hybrid, baseline) in enumerate(zip(unrst[var], self.unrst[var])):
+                with self.subTest(var=var, step=step):
+                    np.testing.assert_allclose(hybrid, baseline, rtol=1e-3, atol=1e-5)
+
 
 if __name__ == "__main__":
     unittest.main()
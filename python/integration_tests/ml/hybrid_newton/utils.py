@@ -433,3 +433,18 @@ ALL_CASES = [
 
     },
 ]
+
+# -------------------------
+# Cached model cases: two configurations sharing one model file
+# -------------------------
+CACHED_MODEL_CASES = [
+    {
+        "label": "cached_model",
+        "mode": "multi",
+        "models": [
+            {"input_features": ["PERMX"], "output_features": ["RS", "PRESSURE", "SGAS", "SOIL"], "start_idx": 0, "end_idx": 1},
+            {"input_features": ["PERMX"], "output_features": ["RS", "PRESSURE", "SGAS", "SOIL"], "start_idx": 0, "end_idx": 1,
+             "apply_idx": 1},
+        ],
+    },
+]
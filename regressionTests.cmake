@@ -1198,6 +1198,14 @@ if(dune-alugrid_FOUND AND BUILD_FLOW_ALU_GRID AND MPI_FOUND)
                            DIR spe1)
 endif()
 
+add_test_compareECLFiles(CASENAME spe1_incremental_iq
+                         FILENAME SPE1CASE1
+                         SIMULATOR flow
+                         ABS_TOL ${abs_tol}
+                         REL_TOL ${coarse_rel_tol}
+                         DIR spe1
+                         TEST_ARGS --incremental-intensive-quantities=true)
+
 if(BUILD_FLOW_FLOAT_VARIANTS)
   add_test_compareECLFiles(CASENAME spe1_float
                            FILENAME SPE1CASE1
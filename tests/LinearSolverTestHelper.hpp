@@ -0,0 +1,99 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef LINEAR_SOLVER_TEST_HELPER_HPP
+#define LINEAR_SOLVER_TEST_HELPER_HPP
+
+namespace LinearSolverTestHelpers {
+
+/**
+ * @brief Fill a block of a non-symmetric, diagonally dominant test matrix.
+ *
+ * The diagonal blocks are dense enough to couple all unknowns of a cell,
+ * the off-diagonal blocks are weighted differently below and above the
+ * diagonal.
+ *
+ * @param diagonal Whether the block is on the diagonal of the matrix
+ * @param lower Whether the block is below the diagonal of the matrix
+ */
+template <class Block>
+void setBlock(Block& block, const bool diagonal, const bool lower)
+{
+    constexpr int n = Block::rows;
+    static_assert(n >= 2, "The test blocks need at least two unknowns");
+
+    block = 0.0;
+    if (diagonal) {
+        for (int i = 0; i < n; ++i) {
+            block[i][i] = 5.0 * (n - 1) - i;
+        }
+        block[0][1] = 0.5;
+        block[1][0] = -0.3;
+        for (int i = 1; i + 1 < n; ++i) {
+            block[i][i + 1] = 0.2;
+            block[i + 1][i] = 0.1;
+        }
+    } else {
+        const double w = lower ? -1.2 : -0.8;
+        for (int i = 0; i < n; ++i) {
+            block[i][i] = i == 0 ? w : (i % 2 == 1 ? w + 0.1 : w - 0.1);
+        }
+        block[0][n - 1] = 0.05;
+    }
+}
+
+/**
+ * @brief Create the matrix of a five-point stencil on an N x N grid.
+ *
+ * The blocks are filled by setBlock(), so the matrix is non-symmetric and
+ * its ILU0 factorization drops fill-in.
+ */
+template <class Matrix>
+Matrix createFivePointMatrix(const int N)
+{
+    Matrix A(N * N, N * N, 5 * N * N, Matrix::row_wise);
+    for (auto row = A.createbegin(); row != A.createend(); ++row) {
+        const int x = row.index() % N;
+        const int y = row.index() / N;
+        if (y > 0) {
+            row.insert(row.index() - N);
+        }
+        if (x > 0) {
+            row.insert(row.index() - 1);
+        }
+        row.insert(row.index());
+        if (x < N - 1) {
+            row.insert(row.index() + 1);
+        }
+        if (y < N - 1) {
+            row.insert(row.index() + N);
+        }
+    }
+
+    for (auto row = A.begin(); row != A.end(); ++row) {
+        for (auto col = row->begin(); col != row->end(); ++col) {
+            setBlock(*col, col.index() == row.index(), col.index() < row.index());
+        }
+    }
+    return A;
+}
+
+} // namespace LinearSolverTestHelpers
+
+#endif // LINEAR_SOLVER_TEST_HELPER_HPP
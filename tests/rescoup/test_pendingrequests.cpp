@@ -0,0 +1,338 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE ResCoup_PendingRequests
+#define BOOST_TEST_NO_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Python/Python.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+
+#include <opm/simulators/flow/rescoup/ReservoirCoupling.hpp>
+#include <opm/simulators/flow/rescoup/ReservoirCouplingMaster.hpp>
+#include <opm/simulators/flow/rescoup/ReservoirCouplingRequests.hpp>
+#include <opm/simulators/utils/ParallelCommunication.hpp>
+#include <opm/simulators/utils/readDeck.hpp>
+
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/common/parallel/mpitraits.hh>
+
+#include <mpi.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Rank 0 plays the master, all other ranks play slaves which finish their
+// step in reverse order of their rank, as if the first slave had the
+// largest model. The messages are large enough to not be sent eagerly.
+
+namespace {
+
+using Opm::ReservoirCoupling::MessageTag;
+using Opm::ReservoirCoupling::PendingRequests;
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t messageSize = 1 << 20;
+constexpr auto slaveStepTime = std::chrono::milliseconds(100);
+// Time the master needs to handle the data of one slave
+constexpr auto processTime = std::chrono::milliseconds(50);
+
+struct Timings
+{
+    double master = 0.0; // Time until the master has handled all data
+    double slaveSend = 0.0; // Time the fastest slave is blocked in its send
+    std::vector<std::size_t> order; // Slaves in the order handled by the master
+};
+
+double secondsSince(const Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+std::vector<double> slaveData(const int rank)
+{
+    return std::vector<double>(messageSize, 10.0 * rank);
+}
+
+void checkData(const std::vector<double>& data, const int rank)
+{
+    BOOST_CHECK_EQUAL(data.size(), messageSize);
+    BOOST_CHECK_EQUAL(data.front(), 10.0 * rank);
+    BOOST_CHECK_EQUAL(data.back(), 10.0 * rank);
+}
+
+Timings exchange(const bool nonBlocking)
+{
+    const MPI_Comm comm = MPI_COMM_WORLD;
+    int rank = 0;
+    int size = 0;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    Timings timings;
+    MPI_Barrier(comm);
+    const auto start = Clock::now();
+    if (rank == 0) {
+        std::vector<std::vector<double>> data(size, std::vector<double>(messageSize));
+        if (nonBlocking) {
+            PendingRequests receives;
+            for (int slave = 1; slave < size; ++slave) {
+                receives.postReceive(data[slave], slave, MessageTag::SlaveProductionData, comm, slave);
+            }
+            while (const auto slave = receives.waitAny()) {
+                timings.order.push_back(*slave);
+                checkData(data[*slave], *slave);
+                std::this_thread::sleep_for(processTime);
+            }
+        } else {
+            for (int slave = 1; slave < size; ++slave) {
+                MPI_Recv(data[slave].data(), messageSize, MPI_DOUBLE, slave,
+                         static_cast<int>(MessageTag::SlaveProductionData), comm, MPI_STATUS_IGNORE);
+                timings.order.push_back(slave);
+                checkData(data[slave], slave);
+                std::this_thread::sleep_for(processTime);
+            }
+        }
+        timings.master = secondsSince(start);
+    } else {
+        std::this_thread::sleep_for((size - rank) * slaveStepTime);
+        const auto data = slaveData(rank);
+        const auto sendStart = Clock::now();
+        MPI_Send(data.data(), messageSize, MPI_DOUBLE, 0,
+                 static_cast<int>(MessageTag::SlaveProductionData), comm);
+        timings.slaveSend = secondsSince(sendStart);
+    }
+
+    MPI_Bcast(&timings.master, 1, MPI_DOUBLE, 0, comm);
+    // The last rank is the fastest slave.
+    MPI_Bcast(&timings.slaveSend, 1, MPI_DOUBLE, size - 1, comm);
+    return timings;
+}
+
+// Each slave has two slave groups, with data identifying slave and group.
+constexpr std::size_t numSlaveGroups = 2;
+
+std::string slaveName(const int rank)
+{
+    return "RES-" + std::to_string(rank);
+}
+
+std::string masterGroupName(const int rank, const std::size_t group)
+{
+    return "G" + std::to_string(rank) + "_" + std::to_string(group);
+}
+
+double groupValue(const int rank, const std::size_t group)
+{
+    return 10.0 * rank + group;
+}
+
+// The schedule of the master needs a SLAVES keyword for the master to activate.
+Opm::Schedule masterSchedule()
+{
+    auto parseContext = Opm::setupParseContext(/*exitOnAllErrors=*/false);
+    parseContext->update(Opm::ParseContext::SCHEDULE_INVALID_NAME, Opm::InputErrorAction::WARN);
+    Opm::ErrorGuard errors;
+    const auto deck = Opm::Parser{}.parseFile("RC-01_MAST_PRED.DATA", *parseContext, errors);
+    const Opm::EclipseState eclipseState(deck);
+    return Opm::Schedule(deck, eclipseState, *parseContext, errors, std::make_shared<Opm::Python>());
+}
+
+// Intercommunicator between the master (rank 0) and one slave, like the one
+// created by MPI_Comm_spawn() for a slave with a single process.
+MPI_Comm masterSlaveComm(const int slave)
+{
+    int rank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm comm;
+    MPI_Intercomm_create(MPI_COMM_SELF, 0, MPI_COMM_WORLD, rank == 0 ? slave : 0,
+                         /*tag=*/slave, &comm);
+    return comm;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(ReceivesCompleteInArrivalOrder)
+{
+    int rank = 0;
+    int size = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    if (size < 3) {
+        BOOST_TEST_MESSAGE("Needs at least 3 processes, skipping");
+        return;
+    }
+
+    const auto blocking = exchange(/*nonBlocking=*/false);
+    const auto nonBlocking = exchange(/*nonBlocking=*/true);
+
+    // The timings depend on the load of the machine, so they are only reported.
+    BOOST_TEST_MESSAGE("Master with " << size - 1 << " slaves: "
+                       << blocking.master << " s blocking, "
+                       << nonBlocking.master << " s non-blocking");
+    BOOST_TEST_MESSAGE("Fastest slave blocked in send: "
+                       << blocking.slaveSend << " s blocking, "
+                       << nonBlocking.slaveSend << " s non-blocking");
+
+    if (rank == 0) {
+        // Blocking: the slaves are handled in the order of their ranks.
+        // Non-blocking: the slaves are handled as they arrive, which is the
+        // reverse order of their ranks.
+        std::vector<std::size_t> rankOrder;
+        for (int slave = 1; slave < size; ++slave) {
+            rankOrder.push_back(slave);
+        }
+        const std::vector<std::size_t> arrivalOrder(rankOrder.rbegin(), rankOrder.rend());
+        BOOST_CHECK_EQUAL_COLLECTIONS(blocking.order.begin(), blocking.order.end(),
+                                      rankOrder.begin(), rankOrder.end());
+        BOOST_CHECK_EQUAL_COLLECTIONS(nonBlocking.order.begin(), nonBlocking.order.end(),
+                                      arrivalOrder.begin(), arrivalOrder.end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SendsKeepTheirData)
+{
+    const MPI_Comm comm = MPI_COMM_WORLD;
+    int rank = 0;
+    int size = 0;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    if (rank == 0) {
+        PendingRequests sends;
+        for (int slave = 1; slave < size; ++slave) {
+            // The vector goes out of scope before the send completes.
+            sends.postSend(slaveData(slave), slave, MessageTag::ProductionGroupConstraints, comm);
+        }
+        BOOST_CHECK(!sends.empty());
+        sends.waitAll();
+        BOOST_CHECK(sends.empty());
+    } else {
+        std::this_thread::sleep_for(slaveStepTime);
+        std::vector<double> data(messageSize);
+        MPI_Recv(data.data(), messageSize, MPI_DOUBLE, 0,
+                 static_cast<int>(MessageTag::ProductionGroupConstraints), comm, MPI_STATUS_IGNORE);
+        checkData(data, rank);
+    }
+}
+
+// The master handles the data of the slaves at the end of a step through
+// ReservoirCouplingMasterReportStep, with the receives posted before the
+// master computes its own step.
+BOOST_AUTO_TEST_CASE(MasterReportStepReceivesSlaveData)
+{
+    using SlaveGroupProductionData = Opm::ReservoirCoupling::SlaveGroupProductionData<double>;
+    using SlaveGroupInjectionData = Opm::ReservoirCoupling::SlaveGroupInjectionData<double>;
+    using Opm::ReservoirCoupling::Phase;
+    using Opm::ReservoirCoupling::RateKind;
+
+    int rank = 0;
+    int size = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    if (rank == 0) {
+        const auto schedule = masterSchedule();
+        const Opm::Parallel::Communication comm(MPI_COMM_SELF);
+        Opm::ReservoirCouplingMaster<double> master(comm, schedule, 0, nullptr);
+        std::vector<MPI_Comm> slaveComms;
+        for (int slave = 1; slave < size; ++slave) {
+            slaveComms.push_back(masterSlaveComm(slave));
+            master.addSlaveCommunicator(slaveComms.back());
+            master.addSlaveName(slaveName(slave));
+            std::map<std::string, std::size_t> groupOrder;
+            for (std::size_t group = 0; group < numSlaveGroups; ++group) {
+                groupOrder[masterGroupName(slave, group)] = group;
+                master.getMasterGroupToSlaveNameMap()[masterGroupName(slave, group)] = slaveName(slave);
+            }
+            master.updateMasterGroupNameOrderMap(slaveName(slave), groupOrder);
+        }
+        master.resizeSlaveActivationDates(size - 1);
+        for (int slave = 1; slave < size; ++slave) {
+            master.setSlaveActivationDate(slave - 1, schedule.getStartTime());
+        }
+        master.initTimeStepping();
+        master.initStartOfReportStep(0);
+        master.maybeReceiveActivationHandshakeFromSlaves(/*current_time=*/0.0);
+        BOOST_CHECK_EQUAL(master.numActivatedSlaves(), static_cast<std::size_t>(size - 1));
+
+        master.postReceiveDataFromSlaves();
+        master.receiveDataFromSlaves();
+
+        for (int slave = 1; slave < size; ++slave) {
+            for (std::size_t group = 0; group < numSlaveGroups; ++group) {
+                const auto name = masterGroupName(slave, group);
+                const double value = groupValue(slave, group);
+                BOOST_CHECK_EQUAL(master.getSlaveGroupPotentials(name)[Phase::Oil], value);
+                BOOST_CHECK_EQUAL(master.getMasterGroupRate(name, Phase::Gas, RateKind::ProductionSurface),
+                                  2.0 * value);
+                BOOST_CHECK_EQUAL(master.getMasterGroupRate(name, Phase::Water, RateKind::InjectionSurface),
+                                  3.0 * value);
+            }
+        }
+        for (auto& slaveComm : slaveComms) {
+            MPI_Comm_free(&slaveComm);
+        }
+    } else {
+        MPI_Comm comm = masterSlaveComm(rank);
+        const std::uint8_t handshake = 1;
+        MPI_Send(&handshake, 1, Dune::MPITraits<std::uint8_t>::getType(), 0,
+                 static_cast<int>(MessageTag::SlaveActivationHandshake), comm);
+
+        std::vector<SlaveGroupProductionData> production(numSlaveGroups);
+        std::vector<SlaveGroupInjectionData> injection(numSlaveGroups);
+        for (std::size_t group = 0; group < numSlaveGroups; ++group) {
+            production[group].potentials[Phase::Oil] = groupValue(rank, group);
+            production[group].surface_rates[Phase::Gas] = 2.0 * groupValue(rank, group);
+            injection[group].surface_rates[Phase::Water] = 3.0 * groupValue(rank, group);
+        }
+        // The slaves finish their step in reverse order of their rank.
+        std::this_thread::sleep_for((size - rank) * slaveStepTime);
+        PendingRequests sends;
+        sends.postSend(std::move(production), 0, MessageTag::SlaveProductionData, comm);
+        sends.postSend(std::move(injection), 0, MessageTag::SlaveInjectionData, comm);
+        sends.waitAll();
+        MPI_Comm_free(&comm);
+    }
+}
+
+bool init_unit_test_func()
+{
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+    return boost::unit_test::unit_test_main(&init_unit_test_func, argc, argv);
+}
@@ -73,3 +73,30 @@ BOOST_AUTO_TEST_CASE(GroupStateCreate)
     gs.communicate_rates(comm);
     BOOST_CHECK(gs2 == gs);
 }
+
+BOOST_AUTO_TEST_CASE(GroupStateCopyAssign)
+{
+    std::size_t num_phases{3};
+    GroupState<double> gs(num_phases);
+    gs.update_production_rates("AGROUP", {1, 2, 3});
+    gs.update_injection_rein_rates("AGROUP", {4, 5, 6});
+    gs.production_control("AGROUP", Group::ProductionCMode::ORAT);
+
+    GroupState<double> gs2 = gs;
+    const auto* rates = gs2.production_rates("AGROUP").data();
+
+    // Assigning a state with the same groups keeps the storage of the rates.
+    gs.update_production_rates("AGROUP", {7, 8, 9});
+    gs.production_control("AGROUP", Group::ProductionCMode::GRAT);
+    gs2 = gs;
+    BOOST_CHECK(gs2 == gs);
+    BOOST_CHECK_EQUAL(gs2.production_rates("AGROUP").data(), rates);
+    BOOST_CHECK(gs2.production_control("AGROUP") == Group::ProductionCMode::GRAT);
+
+    // Assigning a state with other groups replaces them.
+    GroupState<double> gs3(num_phases);
+    gs3.update_production_rates("BGROUP", {1, 1, 1});
+    gs2 = gs3;
+    BOOST_CHECK(gs2 == gs3);
+    BOOST_CHECK(!gs2.has_production_rates("AGROUP"));
+}
@@ -21,6 +21,7 @@
 
 #include <opm/common/utility/FileSystem.hpp>
 
+#include <opm/simulators/utils/HDF5Checkpoint.hpp>
 #include <opm/simulators/utils/HDF5Serializer.hpp>
 
 #include <opm/input/eclipse/Schedule/Group/Group.hpp>
@@ -31,6 +32,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <filesystem>
+#include <vector>
 
 using namespace Opm;
 
@@ -94,6 +96,63 @@ BOOST_AUTO_TEST_CASE(WriteRead)
     std::filesystem::remove(path);
 }
 
+BOOST_AUTO_TEST_CASE(IncrementalCheckpoint)
+{
+    auto path = std::filesystem::temp_directory_path() / Opm::unique_path("hdf5test%%%%%");
+    std::filesystem::create_directory(path);
+    auto rwpath = (path / "rw.hdf5").string();
+#if HAVE_MPI
+    Parallel::Communication comm(MPI_COMM_SELF);
+#else
+    Parallel::Communication comm{};
+#endif
+    const auto group = Group::serializationTestObject();
+    std::vector<std::vector<double>> fields;
+    std::vector<double> field(100000);
+    for (std::size_t i = 0; i < field.size(); ++i) {
+        field[i] = i;
+    }
+    fields.push_back(field);
+    field[10] = -1.0;
+    fields.push_back(field);
+    fields.push_back(field);
+    field.resize(field.size() / 2);
+    fields.push_back(field);
+
+    std::size_t fullSize = 0;
+    {
+        CheckpointWriter writer(rwpath, comm, true, true);
+        for (std::size_t step = 0; step < fields.size(); ++step) {
+            CheckpointSnapshot snapshot;
+            const std::string groupName = "/report_step/" + std::to_string(step);
+            snapshot.write(fields[step], groupName, "field");
+            snapshot.write(group, groupName, "group");
+            fullSize += snapshot.datasets()[0].buffer.size();
+            writer.write(std::move(snapshot), step == 0);
+        }
+        writer.wait();
+        // Unchanged blocks are only written once.
+        BOOST_CHECK_LT(writer.bytesWritten(), fullSize / 2);
+    }
+    {
+        HDF5Serializer ser(rwpath, HDF5File::OpenMode::READ, comm);
+        BOOST_CHECK_EQUAL(ser.lastReportStep(), 3);
+        for (std::size_t step = 0; step < fields.size(); ++step) {
+            const std::string groupName = "/report_step/" + std::to_string(step);
+            std::vector<double> input;
+            ser.read(input, groupName, "field");
+            BOOST_CHECK_EQUAL_COLLECTIONS(input.begin(), input.end(),
+                                          fields[step].begin(), fields[step].end());
+            Group inputGroup;
+            ser.read(inputGroup, groupName, "group");
+            BOOST_CHECK_MESSAGE(inputGroup == group, "Deserialized data does not match input");
+        }
+    }
+
+    std::filesystem::remove(rwpath);
+    std::filesystem::remove(path);
+}
+
 bool init_unit_test_func()
 {
     return true;
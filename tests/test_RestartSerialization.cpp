@@ -345,7 +345,7 @@ public:
     void calcInjResvCoeff(const int, const int, std::vector<double>&) const override
     {}
 
-    void computePotentials(const std::size_t,
+    void computePotentials(const std::vector<std::size_t>&,
                            const WellState<double, IndexTraits>&,
                            std::string&,
                            ExceptionType::ExcEnum&) override
@@ -0,0 +1,127 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE BISAITest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/linalg/BISAI.hpp>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+#include <dune/istl/preconditioners.hh>
+
+#include <cstddef>
+
+#include "LinearSolverTestHelper.hpp"
+
+namespace {
+
+constexpr int bz = 3;
+using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, bz, bz>>;
+using Vector = Dune::BlockVector<Dune::FieldVector<double, bz>>;
+
+// Block matrix with all blocks present, for which ILU0 is the exact LU
+// factorization and the approximate inverses are exact.
+Matrix createDenseMatrix(const int N)
+{
+    Matrix A(N, N, N * N, Matrix::row_wise);
+    for (auto row = A.createbegin(); row != A.createend(); ++row) {
+        for (int col = 0; col < N; ++col) {
+            row.insert(col);
+        }
+    }
+    for (auto row = A.begin(); row != A.end(); ++row) {
+        for (auto col = row->begin(); col != row->end(); ++col) {
+            LinearSolverTestHelpers::setBlock(*col, col.index() == row.index(),
+                                              col.index() < row.index());
+        }
+    }
+    return A;
+}
+
+Vector createRhs(const std::size_t size)
+{
+    Vector d(size);
+    for (std::size_t i = 0; i < d.size(); ++i) {
+        d[i][0] = 1.0 + i % 5;
+        d[i][1] = -0.5 * (i % 3);
+        d[i][2] = 0.25 * (i % 7);
+    }
+    return d;
+}
+
+}
+
+using LinearSolverTestHelpers::createFivePointMatrix;
+
+BOOST_AUTO_TEST_CASE(ExactForFullPattern)
+{
+    const Matrix A = createDenseMatrix(6);
+    const Vector d = createRhs(A.N());
+
+    Opm::BISAI<Matrix, Vector, Vector> bisai(A, 1.0);
+    Dune::SeqILU<Matrix, Vector, Vector> ilu(A, 1.0);
+
+    Vector v1(A.N()), v2(A.N());
+    v1 = 0.0;
+    v2 = 0.0;
+    bisai.apply(v1, d);
+    ilu.apply(v2, d);
+
+    for (std::size_t i = 0; i < v1.size(); ++i) {
+        for (int j = 0; j < bz; ++j) {
+            BOOST_CHECK_CLOSE(v1[i][j], v2[i][j], 1e-8);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ApproximatesILU0)
+{
+    Matrix A = createFivePointMatrix<Matrix>(8);
+    const Vector d = createRhs(A.N());
+
+    Opm::BISAI<Matrix, Vector, Vector> bisai(A, 1.0);
+    Dune::SeqILU<Matrix, Vector, Vector> ilu(A, 1.0);
+
+    Vector v1(A.N()), v2(A.N());
+    v1 = 0.0;
+    v2 = 0.0;
+    bisai.apply(v1, d);
+    ilu.apply(v2, d);
+
+    Vector diff = v1;
+    diff -= v2;
+    BOOST_CHECK_LT(diff.two_norm(), 0.25 * v2.two_norm());
+
+    // Updating with a scaled matrix scales the preconditioned vector.
+    A *= 2.0;
+    bisai.update();
+    Vector v3(A.N());
+    v3 = 0.0;
+    bisai.apply(v3, d);
+    for (std::size_t i = 0; i < v1.size(); ++i) {
+        for (int j = 0; j < bz; ++j) {
+            BOOST_CHECK_CLOSE(2.0 * v3[i][j], v1[i][j], 1e-10);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE ChowPatelILUTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/linalg/ChowPatelILU.hpp>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+#include <dune/istl/preconditioners.hh>
+
+#include <cstddef>
+
+#include "LinearSolverTestHelper.hpp"
+
+namespace {
+
+constexpr int bz = 2;
+using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, bz, bz>>;
+using Vector = Dune::BlockVector<Dune::FieldVector<double, bz>>;
+
+}
+
+using LinearSolverTestHelpers::createFivePointMatrix;
+
+BOOST_AUTO_TEST_CASE(ConvergesToILU0)
+{
+    const Matrix A = createFivePointMatrix<Matrix>(8);
+    Vector d(A.N());
+    for (std::size_t i = 0; i < d.size(); ++i) {
+        d[i][0] = 1.0 + i % 5;
+        d[i][1] = -0.5 * (i % 3);
+    }
+
+    // The fixed-point iteration reaches the exact ILU0 factors after
+    // a number of sweeps bounded by the depth of the dependencies.
+    Opm::ChowPatelILU<Matrix, Vector, Vector> chowPatel(A, 40);
+    Dune::SeqILU<Matrix, Vector, Vector> ilu(A, 1.0);
+
+    Vector v1(A.N()), v2(A.N());
+    v1 = 0.0;
+    v2 = 0.0;
+    chowPatel.apply(v1, d);
+    ilu.apply(v2, d);
+
+    for (std::size_t i = 0; i < v1.size(); ++i) {
+        for (int j = 0; j < bz; ++j) {
+            BOOST_CHECK_CLOSE(v1[i][j], v2[i][j], 1e-8);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(FewSweepsApproximateILU0)
+{
+    Matrix A = createFivePointMatrix<Matrix>(8);
+    Vector d(A.N());
+    d = 1.0;
+
+    Opm::ChowPatelILU<Matrix, Vector, Vector> chowPatel(A, 3);
+    Dune::SeqILU<Matrix, Vector, Vector> ilu(A, 1.0);
+
+    Vector v1(A.N()), v2(A.N());
+    v1 = 0.0;
+    v2 = 0.0;
+    chowPatel.apply(v1, d);
+    ilu.apply(v2, d);
+
+    v1 -= v2;
+    BOOST_CHECK_LT(v1.two_norm(), 0.1 * v2.two_norm());
+
+    // Updating with a scaled matrix scales the preconditioned vector.
+    A *= 2.0;
+    chowPatel.update();
+    Vector v3(A.N());
+    v3 = 0.0;
+    chowPatel.apply(v3, d);
+    v1 += v2;
+    for (std::size_t i = 0; i < v1.size(); ++i) {
+        for (int j = 0; j < bz; ++j) {
+            BOOST_CHECK_CLOSE(2.0 * v3[i][j], v1[i][j], 1e-10);
+        }
+    }
+}
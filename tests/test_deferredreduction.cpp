@@ -0,0 +1,141 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE DeferredReductionTest
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/utils/DeferredReduction.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+// Communication of a fixed number of processes which all contribute the
+// same values, and which counts the collective operations.
+struct CountingCommunication
+{
+    int size = 4;
+    mutable std::size_t numCollectives = 0;
+
+    double sum(const double value) const
+    {
+        ++numCollectives;
+        return size * value;
+    }
+
+    int sum(double* inout, const int len) const
+    {
+        ++numCollectives;
+        std::transform(inout, inout + len, inout, [this](const double v) { return size * v; });
+        return 0;
+    }
+
+    int max(double*, int) const
+    {
+        ++numCollectives;
+        return 0;
+    }
+};
+
+using Reduction = Opm::DeferredReduction<double, CountingCommunication>;
+
+// Local rates of one group, for each of the checked control modes, as in the
+// group constraint checks of the well model.
+constexpr std::size_t numModes = 9;
+std::array<double, numModes> localGroupRates(const std::size_t group)
+{
+    std::array<double, numModes> rates;
+    for (std::size_t mode = 0; mode < numModes; ++mode) {
+        rates[mode] = 1.0 + group + 0.1 * mode;
+    }
+    return rates;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(SumsAndMaxima)
+{
+    const CountingCommunication comm;
+    Reduction reduction(comm);
+    const auto a = reduction.sum(1.5);
+    const auto b = reduction.max(-2.0);
+    const auto c = reduction.sum(2.0);
+    BOOST_CHECK_EQUAL(reduction.size(), 3u);
+
+    reduction.reduce();
+    BOOST_CHECK_EQUAL(reduction[a], 6.0);
+    BOOST_CHECK_EQUAL(reduction[b], -2.0);
+    BOOST_CHECK_EQUAL(reduction[c], 8.0);
+    BOOST_CHECK_EQUAL(reduction.numCollectives(), 2u);
+    BOOST_CHECK_EQUAL(comm.numCollectives, 2u);
+
+    // A batch without maxima needs a single collective.
+    reduction.clear();
+    const auto d = reduction.sum(0.25);
+    reduction.reduce();
+    BOOST_CHECK_EQUAL(reduction[d], 1.0);
+    BOOST_CHECK_EQUAL(comm.numCollectives, 3u);
+
+    // An empty batch needs none.
+    reduction.clear();
+    reduction.reduce();
+    BOOST_CHECK_EQUAL(comm.numCollectives, 3u);
+}
+
+BOOST_AUTO_TEST_CASE(CollectivesPerGroupPass)
+{
+    // One pass over the group controls of a model with many groups, once with
+    // a scalar reduction per rate and once with one deferred reduction per group.
+    const std::size_t numGroups = 1000;
+
+    const CountingCommunication scalarComm;
+    std::vector<double> scalarRates;
+    for (std::size_t group = 0; group < numGroups; ++group) {
+        for (const double rate : localGroupRates(group)) {
+            scalarRates.push_back(scalarComm.sum(rate));
+        }
+    }
+
+    const CountingCommunication deferredComm;
+    std::vector<double> deferredRates;
+    for (std::size_t group = 0; group < numGroups; ++group) {
+        Reduction reduction(deferredComm);
+        std::array<Reduction::Handle, numModes> handles;
+        const auto rates = localGroupRates(group);
+        for (std::size_t mode = 0; mode < numModes; ++mode) {
+            handles[mode] = reduction.sum(rates[mode]);
+        }
+        reduction.reduce();
+        for (const auto& handle : handles) {
+            deferredRates.push_back(reduction[handle]);
+        }
+    }
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(scalarRates.begin(), scalarRates.end(),
+                                  deferredRates.begin(), deferredRates.end());
+    BOOST_TEST_MESSAGE("Collectives per group control pass with " << numGroups << " groups: "
+                       << scalarComm.numCollectives << " scalar, "
+                       << deferredComm.numCollectives << " deferred");
+    BOOST_CHECK_EQUAL(scalarComm.numCollectives, numGroups * numModes);
+    BOOST_CHECK_EQUAL(deferredComm.numCollectives, numGroups);
+}
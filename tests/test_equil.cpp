@@ -59,7 +59,12 @@
 #include <dune/common/parallel/mpihelper.hh>
 #endif
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <array>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
@@ -1415,3 +1420,55 @@ BOOST_AUTO_TEST_CASE(DeckWithSwatinit)
     }
 #endif
 }
+
+BOOST_AUTO_TEST_CASE(ThreadedEquilibration)
+{
+    // The equilibrated state must not depend on the number of threads.  The
+    // timings are reported with --log_level=message.
+    using TypeTag = Opm::Properties::TTag::TestEquilTypeTag;
+
+#ifdef _OPENMP
+    const int maxThreads = omp_get_max_threads();
+#else
+    const int maxThreads = 1;
+#endif
+
+    for (const auto* deck : {"equil_base.DATA", "equil_capillary.DATA", "equil_liveoil.DATA",
+                             "equil_rsvd_and_rvvd.DATA", "equil_pbvd_and_pdvd.DATA"})
+    {
+        auto simulator = initSimulator<TypeTag>(deck);
+        const auto& eclipseState = simulator->vanguard().eclState();
+
+        auto equilibrate = [&](const int numThreads)
+        {
+#ifdef _OPENMP
+            omp_set_num_threads(numThreads);
+#endif
+            const auto start = std::chrono::steady_clock::now();
+            EquilFixture::Initializer comp(*simulator->problem().materialLawManager(),
+                                           eclipseState,
+                                           simulator->vanguard().grid(),
+                                           simulator->vanguard().gridView(),
+                                           simulator->vanguard().cartesianMapper(), 9.80665);
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            BOOST_TEST_MESSAGE(deck << ": equilibration with " << numThreads << " thread(s) took "
+                               << elapsed.count() << " s");
+            return std::array{comp.press(), comp.saturation(),
+                              std::vector{comp.rs(), comp.rv(), comp.rvw()}};
+        };
+
+        const auto serial = equilibrate(1);
+        const auto threaded = equilibrate(maxThreads);
+        for (std::size_t q = 0; q < serial.size(); ++q) {
+            BOOST_REQUIRE_EQUAL(serial[q].size(), threaded[q].size());
+            for (std::size_t i = 0; i < serial[q].size(); ++i) {
+                BOOST_CHECK_EQUAL_COLLECTIONS(serial[q][i].begin(), serial[q][i].end(),
+                                              threaded[q][i].begin(), threaded[q][i].end());
+            }
+        }
+    }
+
+#ifdef _OPENMP
+    omp_set_num_threads(maxThreads);
+#endif
+}
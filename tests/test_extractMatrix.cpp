@@ -104,6 +104,10 @@ BOOST_AUTO_TEST_CASE(vectorOps)
     auto v2 = Opm::Details::extractVector(v1, indices);
     BOOST_CHECK_EQUAL_COLLECTIONS(vref.begin(), vref.end(), v2.begin(), v2.end());
 
+    V v4(3);
+    Opm::Details::extractVector(v1, indices, v4);
+    BOOST_CHECK_EQUAL_COLLECTIONS(vref.begin(), vref.end(), v4.begin(), v4.end());
+
     V v3 = v1;
     v3[2] = { 1.1, 1.2 };
     v2[1] = { 1.1, 1.2 };
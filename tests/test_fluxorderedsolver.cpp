@@ -0,0 +1,180 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE FluxOrderedSolverTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/linalg/FluxOrderedSolver.hpp>
+#include <opm/simulators/linalg/matrixblock.hh>
+
+#include <dune/common/fvector.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr int bz = 2;
+using Matrix = Dune::BCRSMatrix<Opm::MatrixBlock<double, bz, bz>>;
+using Vector = Dune::BlockVector<Dune::FieldVector<double, bz>>;
+
+// Flux from cell (x, y) through its face in direction (dx, dy).
+using Velocity = std::function<double(int x, int y, int dx, int dy)>;
+
+// Upwind tracer matrix on an N x N grid, assembled the same way as in the
+// tracer model: an outflow adds to the diagonal of the upstream cell and
+// couples the downstream cell to it.
+Matrix createMatrix(const int N, const Velocity& velocity)
+{
+    Matrix A(N * N, N * N, 5 * N * N, Matrix::row_wise);
+    for (auto row = A.createbegin(); row != A.createend(); ++row) {
+        const int x = row.index() % N;
+        const int y = row.index() / N;
+        if (y > 0) {
+            row.insert(row.index() - N);
+        }
+        if (x > 0) {
+            row.insert(row.index() - 1);
+        }
+        row.insert(row.index());
+        if (x < N - 1) {
+            row.insert(row.index() + 1);
+        }
+        if (y < N - 1) {
+            row.insert(row.index() + N);
+        }
+    }
+    A = 0.0;
+
+    for (int cell = 0; cell < N * N; ++cell) {
+        A[cell][cell][0][0] = 0.1;
+        A[cell][cell][1][1] = 0.1;
+        A[cell][cell][0][1] = 0.01;
+    }
+
+    auto face = [&A, &velocity](int from, int to, int x, int y, int dx, int dy)
+    {
+        double flux = velocity(x, y, dx, dy);
+        if (flux < 0.0) {
+            std::swap(from, to);
+            flux = -flux;
+        }
+        for (int j = 0; j < bz; ++j) {
+            A[to][from][j][j] = -flux;
+            A[from][from][j][j] += flux;
+        }
+    };
+
+    for (int cell = 0; cell < N * N; ++cell) {
+        const int x = cell % N;
+        const int y = cell / N;
+        if (x < N - 1) {
+            face(cell, cell + 1, x, y, 1, 0);
+        }
+        if (y < N - 1) {
+            face(cell, cell + N, x, y, 0, 1);
+        }
+    }
+    return A;
+}
+
+std::vector<Vector> createRhs(const std::size_t size, const std::size_t numRhs)
+{
+    std::vector<Vector> b(numRhs, Vector(size));
+    for (std::size_t k = 0; k < numRhs; ++k) {
+        for (std::size_t i = 0; i < size; ++i) {
+            b[k][i][0] = i % (7 + k) == 0 ? 1.0 : 0.0;
+            b[k][i][1] = (i + k) % 5 == 0 ? 0.5 : 0.0;
+        }
+    }
+    return b;
+}
+
+double relativeResidual(const Matrix& A, const Vector& x, const Vector& b)
+{
+    Vector r = b;
+    A.mmv(x, r);
+    return r.two_norm() / b.two_norm();
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(AcyclicFlowIsSolvedDirectly)
+{
+    const int N = 30;
+    const Matrix A = createMatrix(N, [](int, int, int dx, int) { return dx ? 1.0 : 0.5; });
+    const auto b = createRhs(A.N(), 3);
+    std::vector<Vector> x(b.size(), Vector(A.N()));
+    for (auto& xk : x) {
+        xk = 0.0;
+    }
+
+    Opm::FluxOrderedSolver<Matrix, Vector> solver(A, 1e-2, 20);
+    BOOST_CHECK_EQUAL(solver.numComponents(), A.N());
+    BOOST_CHECK_EQUAL(solver.numCyclicCells(), 0u);
+    BOOST_CHECK(solver.apply(x, b));
+    for (std::size_t k = 0; k < b.size(); ++k) {
+        BOOST_CHECK_LT(relativeResidual(A, x[k], b[k]), 1e-12);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CyclesAreIterated)
+{
+    // Rows of cells alternately flowing left and right form cycles.
+    const int N = 30;
+    const Matrix A = createMatrix(N, [](int x, int y, int dx, int)
+                                     { return dx ? (y % 2 ? 1.0 : -1.0) : (x % 3 ? 0.3 : -0.2); });
+    const auto b = createRhs(A.N(), 3);
+    std::vector<Vector> x(b.size(), Vector(A.N()));
+    for (auto& xk : x) {
+        xk = 0.0;
+    }
+
+    Opm::FluxOrderedSolver<Matrix, Vector> solver(A, 1e-8, 1000);
+    BOOST_CHECK_GT(solver.numCyclicCells(), 0u);
+    BOOST_CHECK_LT(solver.numComponents(), A.N());
+    BOOST_CHECK(solver.apply(x, b));
+    for (std::size_t k = 0; k < b.size(); ++k) {
+        BOOST_CHECK_LT(relativeResidual(A, x[k], b[k]), 1e-6);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(UnresolvedCycleIsReported)
+{
+    // A single vortex with little accumulation needs many sweeps.
+    const int N = 30;
+    const Matrix A = createMatrix(N, [N](int x, int y, int dx, int dy)
+                                     {
+                                         const double cx = x + 0.5 * dx - 0.5 * N;
+                                         const double cy = y + 0.5 * dy - 0.5 * N;
+                                         return dx ? -cy : cx;
+                                     });
+    const auto b = createRhs(A.N(), 1);
+    std::vector<Vector> x(b.size(), Vector(A.N()));
+    x[0] = 0.0;
+
+    Opm::FluxOrderedSolver<Matrix, Vector> solver(A, 1e-8, 2);
+    BOOST_CHECK(!solver.apply(x, b));
+}
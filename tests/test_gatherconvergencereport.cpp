@@ -29,6 +29,9 @@
 #include <opm/simulators/timestepping/gatherConvergenceReport.hpp>
 #include <dune/common/parallel/mpihelper.hh>
 
+#include <chrono>
+#include <string>
+
 #if HAVE_MPI
 struct MPIError
 {
@@ -174,6 +177,79 @@ BOOST_AUTO_TEST_CASE(CNV_PV_SPLIT, * boost::unit_test::precondition(NProc_Is_Not
     BOOST_CHECK_EQUAL(cellCnt[2],    7);
 }
 
+namespace {
+
+    // Converged local report resembling that of a rank with a number of
+    // wells, each contributing convergence metrics for three phases.
+    Opm::ConvergenceReport convergedWellReport(const int rank, const int numWells)
+    {
+        using CR = Opm::ConvergenceReport;
+
+        auto report = CR { 0.1 * rank };
+        for (auto well = 0; well < numWells; ++well) {
+            const auto name = "WellRank" + std::to_string(rank) + "_" + std::to_string(well);
+            for (auto phase = 0; phase < 3; ++phase) {
+                report.setWellConvergenceMetric(CR::WellFailure::Type::MassBalance,
+                                                CR::Severity::None, phase, 1.0e-6, name);
+            }
+        }
+
+        return report;
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(ConvergedReportsAreReduced)
+{
+    const auto cc = Dune::MPIHelper::getCommunication();
+
+    auto cr = convergedWellReport(cc.rank(), 2);
+    cr.setWellGroupTargetsViolated(cc.rank() == cc.size() - 1);
+
+    const auto reduced = gatherConvergenceReport(cr, cc);
+    BOOST_CHECK(!reduced.converged());
+    BOOST_CHECK(reduced.wellGroupTargetsViolated());
+    BOOST_CHECK(!reduced.networkNotYetBalancedForceAnotherNewtonIteration());
+    BOOST_CHECK(!reduced.wellFailed());
+    BOOST_CHECK_CLOSE(reduced.reportTime(), 0.1 * (cc.size() - 1), 1.0e-8);
+    if (cc.size() > 1) {
+        // Metrics are not gathered when all ranks converged.
+        BOOST_CHECK(reduced.wellConvergence().empty());
+    }
+
+    const auto gathered = gatherConvergenceReport(cr, cc, /* gatherDetails = */ true);
+    BOOST_CHECK(gathered.wellGroupTargetsViolated());
+    BOOST_CHECK_CLOSE(gathered.reportTime(), reduced.reportTime(), 1.0e-8);
+    BOOST_CHECK_EQUAL(gathered.wellConvergence().size(), std::size_t(6 * cc.size()));
+}
+
+BOOST_AUTO_TEST_CASE(ReductionLatency)
+{
+    const auto cc = Dune::MPIHelper::getCommunication();
+    const auto cr = convergedWellReport(cc.rank(), 20);
+    const int numIterations = 200;
+
+    auto latency = [&cc, &cr](const bool gatherDetails)
+    {
+        cc.barrier();
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < numIterations; ++i) {
+            const auto report = gatherConvergenceReport(cr, cc, gatherDetails);
+            BOOST_REQUIRE(report.converged());
+        }
+        const std::chrono::duration<double> time =
+            std::chrono::steady_clock::now() - start;
+        return cc.max(time.count() / numIterations);
+    };
+
+    const auto gathered = latency(true);
+    const auto reduced = latency(false);
+
+    BOOST_TEST_MESSAGE("Converged report on " << cc.size() << " processes: "
+                       << 1.0e6 * gathered << " us gathered, "
+                       << 1.0e6 * reduced << " us reduced per iteration");
+}
+
 int main(int argc, char** argv)
 {
     Dune::MPIHelper::instance(argc, argv);
@@ -0,0 +1,72 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+
+#define BOOST_TEST_MODULE HybridNewtonConfigTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/flow/HybridNewtonConfig.hpp>
+#include <opm/simulators/linalg/PropertyTree.hpp>
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+Opm::PropertyTree modelConfig(const std::string& cellFile)
+{
+    Opm::PropertyTree prm;
+    prm.put("model_path", std::string("model.model"));
+    prm.put("cell_indices_file", cellFile);
+    prm.put("apply_times.0", 86400.0);
+    return prm;
+}
+
+void writeCellFile(const std::string& cellFile, const std::string& contents)
+{
+    std::ofstream file(cellFile);
+    file << contents;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(LoadsUniqueCellIndices)
+{
+    const std::string cellFile = "hybridnewton_unique_cells.txt";
+    writeCellFile(cellFile, "# active cells\n3\n\n0\n7\n");
+
+    const Opm::HybridNewtonConfig config(modelConfig(cellFile));
+    const std::vector<int> expected = {3, 0, 7};
+    BOOST_CHECK_EQUAL_COLLECTIONS(config.cell_indices.begin(), config.cell_indices.end(),
+                                  expected.begin(), expected.end());
+    BOOST_CHECK_EQUAL(config.n_cells, expected.size());
+    BOOST_CHECK_EQUAL(config.apply_times.size(), 1u);
+}
+
+// The initial guess is updated for the cells in parallel, which requires
+// each cell to be listed once.
+BOOST_AUTO_TEST_CASE(RejectsDuplicateCellIndices)
+{
+    const std::string cellFile = "hybridnewton_duplicate_cells.txt";
+    writeCellFile(cellFile, "3\n0\n3\n");
+
+    BOOST_CHECK_THROW(Opm::HybridNewtonConfig{modelConfig(cellFile)}, std::runtime_error);
+}
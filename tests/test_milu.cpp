@@ -10,6 +10,7 @@
 #include<dune/common/version.hh>
 #include<dune/common/fmatrix.hh>
 #include<dune/common/fvector.hh>
+#include<dune/istl/paamg/pinfo.hh>
 #include<opm/simulators/linalg/ParallelOverlappingILU0.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
@@ -199,3 +200,45 @@ BOOST_AUTO_TEST_CASE(MILULaplace4)
 {
     test<4>();
 }
+
+template<int bsize>
+void testMultithreaded(Opm::MILU_VARIANT milu)
+{
+    using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, bsize, bsize>>;
+    using Vector = Dune::BlockVector<Dune::FieldVector<double, bsize>>;
+    using ILU = Opm::ParallelOverlappingILU0<Matrix, Vector, Vector, Dune::Amg::SequentialInformation>;
+
+    Matrix A;
+    setupLaplacian(A, 32);
+    ILU serial(A, 0, 1.0, milu, false, true, false);
+    ILU threaded(A, 0, 1.0, milu, false, true, true);
+
+    Vector d(A.N());
+    for (std::size_t i = 0; i < d.size(); ++i) {
+        d[i] = 1.0 + i % 7;
+    }
+    Vector x1(A.N()), x2(A.N());
+    x1 = 0;
+    x2 = 0;
+    serial.apply(x1, d);
+    threaded.apply(x2, d);
+
+    // Level scheduling does not change the operations done per row.
+    for (std::size_t i = 0; i < x1.size(); ++i) {
+        for (int j = 0; j < bsize; ++j) {
+            BOOST_CHECK_CLOSE(x1[i][j], x2[i][j], 1e-12);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MultithreadedILU)
+{
+    testMultithreaded<1>(Opm::MILU_VARIANT::ILU);
+    testMultithreaded<3>(Opm::MILU_VARIANT::ILU);
+}
+
+BOOST_AUTO_TEST_CASE(MultithreadedMILU)
+{
+    testMultithreaded<1>(Opm::MILU_VARIANT::MILU_1);
+    testMultithreaded<2>(Opm::MILU_VARIANT::MILU_2);
+}
@@ -0,0 +1,248 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+
+#define BOOST_TEST_MODULE MixedPrecisionBsrTest
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/test_case.hpp>
+
+#include <opm/simulators/linalg/mixed/bslv.h>
+#include <opm/simulators/linalg/mixed/bsr.h>
+#include <opm/simulators/linalg/mixed/prec.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+// Value of entry (i,j) of the block coupling rows r and c.
+double blockValue(const int r, const int c, const int i, const int j, const int b)
+{
+    if (r == c) {
+        return i == j ? 4.0 * b + 1.0 + 0.1 * i
+                      : 0.1 * std::sin(1.0 + r + 2 * i + 3 * j);
+    }
+    return i == j ? -1.0 + 0.05 * std::cos(r - c + i)
+                  : 0.02 * std::sin(2.0 * r + c + i - j);
+}
+
+// Block matrix of an nx x ny grid with a five-point stencil, or a
+// block-tridiagonal matrix if ny is one. Blocks are column-major.
+bsr_matrix* createMatrix(const int nx, const int ny, const int b)
+{
+    const int nrows = nx * ny;
+    std::vector<std::vector<int>> cols(nrows);
+    for (int y = 0; y < ny; ++y) {
+        for (int x = 0; x < nx; ++x) {
+            auto& row = cols[y * nx + x];
+            if (y > 0) row.push_back((y - 1) * nx + x);
+            if (x > 0) row.push_back(y * nx + x - 1);
+            row.push_back(y * nx + x);
+            if (x < nx - 1) row.push_back(y * nx + x + 1);
+            if (y < ny - 1) row.push_back((y + 1) * nx + x);
+        }
+    }
+
+    int nnz = 0;
+    for (const auto& row : cols) {
+        nnz += row.size();
+    }
+
+    bsr_matrix* A = bsr_alloc();
+    bsr_init(A, nrows, nnz, b);
+    A->rowptr[0] = 0;
+    int k = 0;
+    for (int r = 0; r < nrows; ++r) {
+        for (const int c : cols[r]) {
+            A->colidx[k] = c;
+            for (int i = 0; i < b; ++i) {
+                for (int j = 0; j < b; ++j) {
+                    A->dbl[b * b * k + b * j + i] = blockValue(r, c, i, j, b);
+                }
+            }
+            ++k;
+        }
+        A->rowptr[r + 1] = k;
+    }
+    bsr_downcast(A);
+
+    return A;
+}
+
+// Vectors are padded, since the kernels load full SIMD registers.
+std::vector<double> createVector(const int n)
+{
+    std::vector<double> x(8 * ((n + 7) / 8) + 8, 0.0);
+    for (int k = 0; k < n; ++k) {
+        x[k] = 1.0 + 0.5 * std::sin(0.3 * k);
+    }
+    return x;
+}
+
+// Straightforward y = A x in double precision.
+std::vector<double> referenceSpmv(const bsr_matrix* A, const std::vector<double>& x)
+{
+    const int b = A->b;
+    std::vector<double> y(x.size(), 0.0);
+    for (int r = 0; r < A->nrows; ++r) {
+        for (int k = A->rowptr[r]; k < A->rowptr[r + 1]; ++k) {
+            const int c = A->colidx[k];
+            for (int i = 0; i < b; ++i) {
+                for (int j = 0; j < b; ++j) {
+                    y[b * r + i] += A->dbl[b * b * k + b * j + i] * x[b * c + j];
+                }
+            }
+        }
+    }
+    return y;
+}
+
+double maxRelativeError(const std::vector<double>& x,
+                        const std::vector<double>& ref,
+                        const int n)
+{
+    double max_ref = 0.0;
+    double max_err = 0.0;
+    for (int k = 0; k < n; ++k) {
+        max_ref = std::max(max_ref, std::abs(ref[k]));
+        max_err = std::max(max_err, std::abs(x[k] - ref[k]));
+    }
+    return max_err / max_ref;
+}
+
+const std::vector<int> blockSizes = {2, 3, 4};
+
+}
+
+BOOST_DATA_TEST_CASE(SpmvMatchesReference, blockSizes, b)
+{
+    bsr_matrix* A = createMatrix(7, 5, b);
+    const int n = A->nrows * b;
+    const auto x = createVector(n);
+    const auto ref = referenceSpmv(A, x);
+
+    std::vector<double> y(x.size(), 0.0);
+    bsr_vdspmv(A, x.data(), y.data());
+    BOOST_CHECK_SMALL(maxRelativeError(y, ref, n), 1e-14);
+
+    std::fill(y.begin(), y.end(), 0.0);
+    bsr_vmspmv(A, x.data(), y.data());
+    BOOST_CHECK_SMALL(maxRelativeError(y, ref, n), 1e-6);
+
+    bsr_free(A);
+}
+
+// ILU0 of a block-tridiagonal matrix has no fill-in, so applying the
+// preconditioner solves the system exactly.
+BOOST_DATA_TEST_CASE(LevelScheduledApplySolvesTridiagonal, blockSizes, b)
+{
+    bsr_matrix* A = createMatrix(12, 1, b);
+    const int n = A->nrows * b;
+    const auto x = createVector(n);
+
+    prec_t* P = prec_alloc();
+    prec_init(P, A);
+    prec_ilu0_factorize(P, A);
+    prec_downcast(P);
+
+    auto y = referenceSpmv(A, x);
+    prec_dapply(P, y.data());
+    BOOST_CHECK_SMALL(maxRelativeError(y, x, n), 1e-12);
+
+    y = referenceSpmv(A, x);
+    prec_mapply(P, y.data());
+    BOOST_CHECK_SMALL(maxRelativeError(y, x, n), 1e-5);
+
+    prec_free(P);
+    bsr_free(A);
+}
+
+#ifdef _OPENMP
+// With several threads, 3x3 blocks use the level-scheduled apply instead of
+// the sequential kernels, which serve as reference.
+BOOST_DATA_TEST_CASE(LevelScheduledApplyMatchesSequential3x3,
+                     boost::unit_test::data::make({false, true}), use_dilu)
+{
+    bsr_matrix* A = createMatrix(7, 5, 3);
+    const int n = A->nrows * 3;
+    const auto x = createVector(n);
+
+    prec_t* P = prec_alloc();
+    prec_init(P, A);
+    use_dilu ? prec_dilu_factorize(P, A) : prec_ilu0_factorize(P, A);
+    prec_downcast(P);
+
+    auto ref = x;
+    prec_dapply3c(P, ref.data());
+    auto mref = x;
+    prec_mapply3c(P, mref.data());
+
+    const int num_threads = omp_get_max_threads();
+    omp_set_num_threads(std::max(num_threads, 4));
+    auto y = x;
+    prec_dapply(P, y.data());
+    auto my = x;
+    prec_mapply(P, my.data());
+    omp_set_num_threads(num_threads);
+
+    BOOST_CHECK_SMALL(maxRelativeError(y, ref, n), 1e-14);
+    BOOST_CHECK_SMALL(maxRelativeError(my, mref, n), 1e-6);
+
+    prec_free(P);
+    bsr_free(A);
+}
+#endif
+
+// The mixed-precision solver reaches the solution of the double-precision
+// solver, for all block sizes and both preconditioners.
+BOOST_DATA_TEST_CASE(MixedSolverMatchesDoubleSolver,
+                     boost::unit_test::data::make(blockSizes) *
+                     boost::unit_test::data::make({false, true}), b, use_dilu)
+{
+    bsr_matrix* A = createMatrix(9, 7, b);
+    const int n = A->nrows * b;
+    const auto x_true = createVector(n);
+    const auto rhs = referenceSpmv(A, x_true);
+
+    bslv_memory* mem = bslv_alloc();
+    bslv_init(mem, 1e-10, 200, A, use_dilu);
+
+    std::vector<double> x_double(x_true.size(), 0.0);
+    const int count_double = bslv_pbicgstabd(mem, A, rhs.data(), x_double.data());
+    BOOST_CHECK_LT(count_double, 200);
+    BOOST_CHECK_LT(mem->e[count_double], 1e-10);
+
+    std::vector<double> x_mixed(x_true.size(), 0.0);
+    const int count_mixed = bslv_pbicgstabm(mem, A, rhs.data(), x_mixed.data());
+    BOOST_CHECK_LT(count_mixed, 200);
+    BOOST_CHECK_LT(mem->e[count_mixed], 1e-10);
+
+    BOOST_CHECK_SMALL(maxRelativeError(x_double, x_true, n), 1e-8);
+    BOOST_CHECK_SMALL(maxRelativeError(x_mixed, x_double, n), 1e-5);
+
+    bslv_free(mem);
+    bsr_free(A);
+}
@@ -0,0 +1,245 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+
+#define BOOST_TEST_MODULE MixedPrecisionBsrParallelTest
+#define BOOST_TEST_NO_MAIN
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/test_case.hpp>
+
+#include <opm/simulators/linalg/mixed/bslv.h>
+#include <opm/simulators/linalg/mixed/bsr.h>
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr int b = 3;
+constexpr int numOwned = 10;
+
+// Value of entry (i,j) of the block coupling cells r and c of a chain.
+double blockValue(const int r, const int c, const int i, const int j)
+{
+    if (r == c) {
+        return i == j ? 4.0 * b + 1.0 + 0.1 * i
+                      : 0.1 * std::sin(1.0 + r + 2 * i + 3 * j);
+    }
+    return i == j ? -1.0 + 0.05 * std::cos(r - c + i)
+                  : 0.02 * std::sin(2.0 * r + c + i - j);
+}
+
+double solutionValue(const int cell, const int i)
+{
+    return 1.0 + 0.5 * std::sin(0.3 * (b * cell + i));
+}
+
+// Part of a chain of cells owned by one process. The owned cells come first,
+// followed by copies of the neighbouring cells of the adjacent processes.
+// The rows of these copies are decoupled identity rows, like the overlap rows
+// after makeOverlapRowsInvalid(), which keeps their sparsity pattern.
+struct LocalSystem
+{
+    LocalSystem(const int rank, const int size)
+        : rank_(rank), size_(size)
+    {
+        std::vector<int> global{};
+        for (int k = 0; k < numOwned; ++k) {
+            global.push_back(rank * numOwned + k);
+        }
+        if (rank > 0) {
+            left_ = global.size();
+            global.push_back(rank * numOwned - 1);
+        }
+        if (rank < size - 1) {
+            right_ = global.size();
+            global.push_back((rank + 1) * numOwned);
+        }
+        const int nrows = global.size();
+        const auto local = [&global](const int cell)
+        { return int(std::find(global.begin(), global.end(), cell) - global.begin()); };
+
+        // The sparsity pattern is symmetric, as the factorizations expect.
+        std::vector<std::vector<int>> cols(nrows);
+        for (int r = 0; r < nrows; ++r) {
+            for (const int cell : {global[r] - 1, global[r], global[r] + 1}) {
+                const int c = local(cell);
+                if (c < nrows) {
+                    cols[r].push_back(c);
+                }
+            }
+            std::sort(cols[r].begin(), cols[r].end());
+        }
+
+        int nnz = 0;
+        for (const auto& row : cols) {
+            nnz += row.size();
+        }
+        A = bsr_alloc();
+        bsr_init(A, nrows, nnz, b);
+        A->rowptr[0] = 0;
+        int k = 0;
+        for (int r = 0; r < nrows; ++r) {
+            for (const int c : cols[r]) {
+                A->colidx[k] = c;
+                for (int i = 0; i < b; ++i) {
+                    for (int j = 0; j < b; ++j) {
+                        A->dbl[b * b * k + b * j + i] =
+                            r < numOwned ? blockValue(global[r], global[c], i, j)
+                                         : (r == c && i == j ? 1.0 : 0.0);
+                    }
+                }
+                ++k;
+            }
+            A->rowptr[r + 1] = k;
+        }
+        bsr_downcast(A);
+
+        const int n = nrows * b;
+        const int np = 8 * ((n + 7) / 8) + 8;
+        mask.assign(np, 0.0);
+        std::fill(mask.begin(), mask.begin() + numOwned * b, 1.0);
+
+        // Right-hand side of the global system restricted to this process,
+        // consistent on the copies.
+        rhs.assign(np, 0.0);
+        x_true.assign(np, 0.0);
+        for (int r = 0; r < nrows; ++r) {
+            for (int i = 0; i < b; ++i) {
+                x_true[b * r + i] = solutionValue(global[r], i);
+                for (const int cell : {global[r] - 1, global[r], global[r] + 1}) {
+                    if (cell < 0 || cell >= size * numOwned) {
+                        continue;
+                    }
+                    for (int j = 0; j < b; ++j) {
+                        rhs[b * r + i] += blockValue(global[r], cell, i, j) * solutionValue(cell, j);
+                    }
+                }
+            }
+        }
+    }
+
+    ~LocalSystem()
+    {
+        bsr_free(A);
+    }
+
+    static void allreduce(void* ctx, double* values, int count)
+    {
+        auto& self = *static_cast<LocalSystem*>(ctx);
+        ++self.num_allreduce;
+        MPI_Allreduce(MPI_IN_PLACE, values, count, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    }
+
+    static void exchange(void* ctx, double* x)
+    {
+        auto& self = *static_cast<LocalSystem*>(ctx);
+        ++self.num_exchange;
+        // Send the first owned cell to the left and receive the right copy,
+        // then send the last owned cell to the right and receive the left copy.
+        const int left = self.rank_ > 0 ? self.rank_ - 1 : MPI_PROC_NULL;
+        const int right = self.rank_ < self.size_ - 1 ? self.rank_ + 1 : MPI_PROC_NULL;
+        double dummy[b];
+        MPI_Sendrecv(x, b, MPI_DOUBLE, left, 0,
+                     self.right_ >= 0 ? x + b * self.right_ : dummy, b, MPI_DOUBLE, right, 0,
+                     MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        MPI_Sendrecv(x + b * (numOwned - 1), b, MPI_DOUBLE, right, 1,
+                     self.left_ >= 0 ? x + b * self.left_ : dummy, b, MPI_DOUBLE, left, 1,
+                     MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    }
+
+    bsr_matrix* A = nullptr;
+    std::vector<double> mask;
+    std::vector<double> rhs;
+    std::vector<double> x_true;
+    int num_allreduce = 0;
+    int num_exchange = 0;
+
+private:
+    int rank_;
+    int size_;
+    int left_ = -1;
+    int right_ = -1;
+};
+
+double maxError(const std::vector<double>& x, const std::vector<double>& ref, const int n)
+{
+    double err = 0.0;
+    for (int k = 0; k < n; ++k) {
+        err = std::max(err, std::abs(x[k] - ref[k]));
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &err, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    return err;
+}
+
+}
+
+// The distributed solver, with the preconditioner acting as block-Jacobi
+// across processes, reaches the solution of the global system. The solution
+// is consistent on the copies of the neighbouring cells.
+BOOST_DATA_TEST_CASE(DistributedSolveMatchesGlobalSolution,
+                     boost::unit_test::data::make({false, true}) *
+                     boost::unit_test::data::make({false, true}), mixed, use_dilu)
+{
+    int rank = 0;
+    int size = 1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    LocalSystem sys(rank, size);
+    const int n = sys.A->nrows * b;
+
+    bslv_memory* mem = bslv_alloc();
+    bslv_init(mem, 1e-10, 200, sys.A, use_dilu);
+    bslv_set_comm(mem, &sys, &LocalSystem::allreduce, &LocalSystem::exchange, sys.mask.data());
+
+    std::vector<double> x(sys.rhs.size(), 0.0);
+    const int count = mixed ? bslv_pbicgstabm(mem, sys.A, sys.rhs.data(), x.data())
+                            : bslv_pbicgstabd(mem, sys.A, sys.rhs.data(), x.data());
+
+    // Three reductions per iteration and one before the loop.
+    BOOST_CHECK_LT(count, 200);
+    BOOST_CHECK_LT(mem->e[count], 1e-10);
+    BOOST_CHECK_EQUAL(sys.num_allreduce, 3 * count + 1);
+    BOOST_CHECK_EQUAL(sys.num_exchange, 2 * count + 1);
+
+    // All processes see the same iteration count, since the inner products
+    // are global.
+    int max_count = count;
+    MPI_Allreduce(MPI_IN_PLACE, &max_count, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    BOOST_CHECK_EQUAL(count, max_count);
+
+    BOOST_CHECK_SMALL(maxError(x, sys.x_true, n), mixed ? 1e-5 : 1e-8);
+
+    bslv_free(mem);
+}
+
+bool init_unit_test_func()
+{
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+    return boost::unit_test::unit_test_main(&init_unit_test_func, argc, argv);
+}
@@ -181,3 +181,42 @@ SimpleParamInt="10"
 SimpleParamString="foo"
 )"));
 }
+
+BOOST_FIXTURE_TEST_CASE(SnapshotValues, Fixture)
+{
+  Opm::Parameters::parseParameterFile("parametersystem.ini", true);
+
+  using Params = Opm::Parameters::Snapshot<Opm::Parameters::SimpleParamBool,
+                                           Opm::Parameters::SimpleParamInt,
+                                           Opm::Parameters::SimpleParamString>;
+  const Params snapshot;
+  BOOST_CHECK_EQUAL(snapshot.get<Opm::Parameters::SimpleParamBool>(), true);
+  BOOST_CHECK_EQUAL(snapshot.get<Opm::Parameters::SimpleParamInt>(), 10);
+  BOOST_CHECK_EQUAL(snapshot.get<Opm::Parameters::SimpleParamString>(), "bar");
+
+  // The snapshot keeps the values it was created with.
+  Opm::Parameters::reset();
+  BOOST_CHECK_EQUAL(snapshot.get<Opm::Parameters::SimpleParamString>(), "bar");
+}
+
+BOOST_FIXTURE_TEST_CASE(GetInTimestepLoop, Fixture)
+{
+  using Params = Opm::Parameters::Snapshot<Opm::Parameters::SimpleParamInt>;
+  const Params snapshot;
+  BOOST_CHECK_EQUAL(Opm::Parameters::TimestepLoopScope::numGets(), 0u);
+
+  {
+    Opm::Parameters::TimestepLoopScope scope;
+    // Values of a snapshot do not look the parameter up again.
+    BOOST_CHECK_EQUAL(snapshot.get<Opm::Parameters::SimpleParamInt>(), 10);
+    BOOST_CHECK_EQUAL(Opm::Parameters::TimestepLoopScope::numGets(), 0u);
+
+    // Parameters can still be retrieved inside a scope, which is counted.
+    BOOST_CHECK_EQUAL(Opm::Parameters::Get<Opm::Parameters::SimpleParamInt>(), 10);
+    BOOST_CHECK_EQUAL(Opm::Parameters::TimestepLoopScope::numGets(), 1u);
+  }
+
+  // Outside of a scope, retrieving parameters is not counted.
+  BOOST_CHECK_EQUAL(Opm::Parameters::Get<Opm::Parameters::SimpleParamInt>(), 10);
+  BOOST_CHECK_EQUAL(Opm::Parameters::TimestepLoopScope::numGets(), 1u);
+}
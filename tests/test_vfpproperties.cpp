@@ -23,6 +23,8 @@
 #define BOOST_TEST_MODULE VFPTest
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <memory>
 #include <map>
@@ -100,6 +102,26 @@ BOOST_AUTO_TEST_CASE(findInterpData)
     BOOST_CHECK_EQUAL(eval5.factor_, 1.0);
 }
 
+BOOST_AUTO_TEST_CASE(findInterpDataHint)
+{
+    std::vector<double> values = {1, 5, 7, 9, 11, 15};
+    std::vector<double> points = {-1.0, 1.0, 3.0, 5.0, 6.0, 9.0, 10.0, 15.0, 19.0, 12.0, 2.0};
+
+    // Any hint, including stale and invalid ones, gives the result of the plain search
+    for (int start = -1; start <= 6; ++start) {
+        int hint = start;
+        for (const double point : points) {
+            auto ref = Opm::VFPHelpers<double>::findInterpData(point, values);
+            auto eval = Opm::VFPHelpers<double>::findInterpData(point, values, hint);
+
+            BOOST_CHECK_EQUAL(eval.ind_[0], ref.ind_[0]);
+            BOOST_CHECK_EQUAL(eval.ind_[1], ref.ind_[1]);
+            BOOST_CHECK_EQUAL(eval.factor_, ref.factor_);
+            BOOST_CHECK_EQUAL(hint, ref.ind_[0]);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // HelperTests
 
 
@@ -745,6 +767,73 @@ BOOST_AUTO_TEST_CASE(ParseInterpolateRealisticVFPPROD)
     BOOST_CHECK_SMALL(sad, sad_tol);
 }
 
+/**
+ * Checks the batched interpolation against the pointwise one for the tables in
+ * VFPPROD1 and VFPPROD2, and reports the time spent by both.
+ */
+BOOST_AUTO_TEST_CASE(BatchedInterpolationVFPPROD)
+{
+    auto units = Opm::UnitSystem::newMETRIC();
+    Opm::Parser parser;
+
+    for (const auto* file : {"VFPPROD1", "VFPPROD2"}) {
+        auto deck = parser.parseFile(file);
+        BOOST_REQUIRE(deck.hasKeyword("VFPPROD"));
+
+        for (const auto& keyword : deck["VFPPROD"]) {
+            bool gaslift_active = false;
+            Opm::VFPProdTable table(keyword, gaslift_active, units);
+
+            // Rates over and a bit beyond the flo axis, as sampled by the THP limit solves
+            const int n = 200;
+            std::vector<double> flos(n);
+            for (int i = 0; i < n; ++i) {
+                flos[i] = 1.2 * table.getFloAxis().back() * i / (n - 1);
+            }
+
+            double max_d = 0.0;
+            std::chrono::duration<double> pointwise_time{0};
+            std::chrono::duration<double> batched_time{0};
+            for (const double thp : table.getTHPAxis()) {
+                for (const double wfr : {0.0, 0.15, 0.8}) {
+                    for (const double gfr : {95.0, 300.0, 4000.0}) {
+                        const double t = 1.05 * thp;
+                        const double alq = 0.0;
+
+                        auto start = std::chrono::steady_clock::now();
+                        std::vector<double> pointwise(n);
+                        const auto thp_i = Opm::VFPHelpers<double>::findInterpData(t, table.getTHPAxis());
+                        const auto wfr_i = Opm::VFPHelpers<double>::findInterpData(wfr, table.getWFRAxis());
+                        const auto gfr_i = Opm::VFPHelpers<double>::findInterpData(gfr, table.getGFRAxis());
+                        const auto alq_i = Opm::VFPHelpers<double>::findInterpData(alq, table.getALQAxis());
+                        for (int i = 0; i < n; ++i) {
+                            const auto flo_i = Opm::VFPHelpers<double>::findInterpData(flos[i], table.getFloAxis());
+                            pointwise[i] = Opm::VFPHelpers<double>::interpolate(table, flo_i, thp_i, wfr_i,
+                                                                                gfr_i, alq_i).value;
+                        }
+                        auto end = std::chrono::steady_clock::now();
+                        pointwise_time += end - start;
+
+                        start = std::chrono::steady_clock::now();
+                        const auto bhps = Opm::VFPHelpers<double>::bhps(table, flos, t, wfr, gfr, alq);
+                        end = std::chrono::steady_clock::now();
+                        batched_time += end - start;
+
+                        for (int i = 0; i < n; ++i) {
+                            max_d = std::max(max_d, std::abs(bhps[i] - pointwise[i]) / std::abs(pointwise[i]));
+                        }
+                    }
+                }
+            }
+
+            BOOST_CHECK_SMALL(max_d, max_d_tol);
+            BOOST_TEST_MESSAGE(file << ", table " << table.getTableNum()
+                               << ": pointwise " << pointwise_time.count() << " s, batched "
+                               << batched_time.count() << " s");
+        }
+    }
+}
+
 /**
  * Reference computed using MATLAB with the input above.
  */
@@ -0,0 +1,66 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE WellColoringTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/wells/WellColoring.hpp>
+
+#include <cstddef>
+#include <set>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(NoWells)
+{
+    BOOST_CHECK(Opm::groupWellsByDisjointCells({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(DisjointWellsShareGroup)
+{
+    const std::vector<std::vector<int>> well_cells = {{0, 1, 2}, {5, 6}, {3}};
+    const auto groups = Opm::groupWellsByDisjointCells(well_cells);
+    BOOST_REQUIRE_EQUAL(groups.size(), 1u);
+    const std::vector<int> expected = {0, 1, 2};
+    BOOST_CHECK_EQUAL_COLLECTIONS(groups[0].begin(), groups[0].end(),
+                                  expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(SharedCellsSeparateGroups)
+{
+    // Wells 0, 1 and 2 all perforate cell 4, well 3 shares cell 7 with well 1.
+    const std::vector<std::vector<int>> well_cells = {{4, 5}, {4, 7}, {3, 4}, {7, 8}};
+    const auto groups = Opm::groupWellsByDisjointCells(well_cells);
+    BOOST_REQUIRE_EQUAL(groups.size(), 3u);
+
+    const std::vector<std::vector<int>> expected = {{0, 3}, {1}, {2}};
+    for (std::size_t g = 0; g < groups.size(); ++g) {
+        BOOST_CHECK_EQUAL_COLLECTIONS(groups[g].begin(), groups[g].end(),
+                                      expected[g].begin(), expected[g].end());
+
+        // No cell is perforated twice within a group.
+        std::set<int> cells;
+        for (const int w : groups[g]) {
+            for (const int cell : well_cells[w]) {
+                BOOST_CHECK(cells.insert(cell).second);
+            }
+        }
+    }
+}